@@ -14,7 +14,7 @@ use Config::Generate;
 
 
 my %opts;
-GetOptions(\%opts, 'help|?', 'debug!', 'optimize!', 'instrument!', 'clang!');
+GetOptions(\%opts, 'help|?', 'debug!', 'optimize!', 'instrument!', 'clang!', 'cgoto!');
 pod2usage(1) if $opts{help};
 
 print "Welcome to MoarVM!\n\n";
@@ -24,6 +24,7 @@ $opts{debug}      //= 0 + !$opts{optimize};
 $opts{optimize}   //= 0 + !$opts{debug};
 $opts{clang}      //= 0;
 $opts{instrument} //= 0;
+$opts{cgoto}      //= 1;
 print " OK\n    (debug: " . _yn($opts{debug})
     . ", optimize: "      . _yn($opts{optimize})
     . ", instrument: "    . _yn($opts{instrument})
@@ -39,6 +40,10 @@ else {
     die "    Sorry, I'm not sure how to build on this platform:\n    $config{'excuse'}\n";
 }
 
+print dots("Choosing interpreter dispatch ...");
+$config{cgoto} = $opts{cgoto} && $config{cancgoto} ? 1 : 0;
+print " OK\n    (" . ($config{cgoto} ? 'computed goto' : 'switch') . ")\n";
+
 print dots("Configuring APR ...");
 %config = Config::APR::configure(%config);
 check_excuse();
@@ -84,7 +89,7 @@ __END__
 =head1 SYNOPSIS
 
     ./Configure.pl [-?|--help]
-    ./Configure.pl [--debug] [--optimize] [--instrument]
+    ./Configure.pl [--debug] [--optimize] [--instrument] [--no-cgoto]
 
 =head1 OPTIONS
 
@@ -113,4 +118,11 @@ defaults to the opposite of C<--debug>.
 Turn on extra instrumentation flags during compile and link; for example,
 turns on Address Sanitizer when compiling with F<clang>.  Defaults to off.
 
+=item --cgoto
+
+Use computed goto (the labels-as-values extension) for the interpreter's
+op dispatch, if the compiler supports it.  Defaults to on; with
+C<--no-cgoto>, or on compilers without the extension, the interpreter
+falls back to a portable C<switch>.
+
 =back
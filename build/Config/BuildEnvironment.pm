@@ -50,6 +50,9 @@ my %TOOLCHAINS = (
                 noreturn    => '__declspec(noreturn)',
                 noreturngcc => '',
 
+                # No labels-as-values support
+                cancgoto    => 0,
+
                 # Required flags
                 couto       => '-Fo',
                 louto       => '-out:',
@@ -72,6 +75,9 @@ my %TOOLCHAINS = (
                 cc          => 'gcc',
                 link        => 'gcc',
 
+                # Supports labels-as-values, for computed goto dispatch
+                cancgoto    => 1,
+
                 # Required flags
                 cmiscflags  => '-D_REENTRANT -D_LARGEFILE64_SOURCE -Wparentheses -Wreturn-type',
                 lmiscflags  => '-L3rdparty/apr/.libs',
@@ -92,6 +98,9 @@ my %TOOLCHAINS = (
                 cc          => 'clang',
                 link        => 'clang',
 
+                # Supports labels-as-values, for computed goto dispatch
+                cancgoto    => 1,
+
                 # Required flags
                 cmiscflags  => '-fno-omit-frame-pointer -fno-optimize-sibling-calls',
                 lmiscflags  => '-L3rdparty/apr/.libs',
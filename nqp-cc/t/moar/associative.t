@@ -1,7 +1,7 @@
 #!nqp
 use MASTTesting;
 
-plan(7);
+plan(9);
 
 sub hash_type($frame) {
     my @ins := $frame.instructions;
@@ -168,3 +168,84 @@ mast_frame_output_is(-> $frame, @ins, $cu {
     },
     "bar\n1\nbaz\n1\n",
     "associative Replace works");
+
+mast_frame_output_is(-> $frame, @ins, $cu {
+        my $ht := hash_type($frame);
+        my $r0 := local($frame, NQPMu);
+        my $r1 := local($frame, NQPMu);
+        my $r2 := local($frame, str);
+        my $r3 := local($frame, int);
+        my $r4 := local($frame, NQPMu);
+        my $walk := label('walk');
+        my $done := label('done');
+        op(@ins, 'create', $r0, $ht);
+        for 0, 1, 2, 3, 4, 5 {
+            op(@ins, 'const_s', $r2, sval("k$_"));
+            op(@ins, 'bindkey_o', $r0, $r2, $r0);
+        }
+        for 1, 2, 3 {
+            op(@ins, 'const_s', $r2, sval("k$_"));
+            op(@ins, 'deletekey', $r0, $r2);
+        }
+        op(@ins, 'iter', $r1, $r0);
+        op(@ins, 'shift_o', $r4, $r1);
+        op(@ins, 'shift_o', $r4, $r1);
+        op(@ins, 'iterkey_s', $r2, $r1);
+        op(@ins, 'say', $r2);
+        for 6, 7, 8, 9 {
+            op(@ins, 'const_s', $r2, sval("k$_"));
+            op(@ins, 'bindkey_o', $r0, $r2, $r0);
+        }
+        op(@ins, 'iterkey_s', $r2, $r1);
+        op(@ins, 'say', $r2);
+        nqp::push(@ins, $walk);
+        op(@ins, 'istrue', $r3, $r1);
+        op(@ins, 'unless_i', $r3, $done);
+        op(@ins, 'shift_o', $r4, $r1);
+        op(@ins, 'iterkey_s', $r2, $r1);
+        op(@ins, 'say', $r2);
+        op(@ins, 'goto', $walk);
+        nqp::push(@ins, $done);
+        op(@ins, 'return');
+    },
+    "k4\nk4\nk5\nk6\nk7\nk8\nk9\n",
+    "Iterator keeps its place when adding keys drops deleted ones");
+
+mast_frame_output_is(-> $frame, @ins, $cu {
+        my $ht := hash_type($frame);
+        my $r0 := local($frame, NQPMu);
+        my $r1 := local($frame, NQPMu);
+        my $r2 := local($frame, str);
+        my $r3 := local($frame, int);
+        my $r4 := local($frame, NQPMu);
+        my $walk := label('walk');
+        my $done := label('done');
+        op(@ins, 'create', $r0, $ht);
+        for 0, 1, 2, 3, 4, 5 {
+            op(@ins, 'const_s', $r2, sval("k$_"));
+            op(@ins, 'bindkey_o', $r0, $r2, $r0);
+        }
+        op(@ins, 'iter', $r1, $r0);
+        for 0, 1, 2, 3, 4, 5 {
+            op(@ins, 'shift_o', $r4, $r1);
+        }
+        op(@ins, 'iterkey_s', $r2, $r1);
+        op(@ins, 'say', $r2);
+        op(@ins, 'const_s', $r2, sval('k5'));
+        op(@ins, 'deletekey', $r0, $r2);
+        for 6, 7, 8 {
+            op(@ins, 'const_s', $r2, sval("k$_"));
+            op(@ins, 'bindkey_o', $r0, $r2, $r0);
+        }
+        nqp::push(@ins, $walk);
+        op(@ins, 'istrue', $r3, $r1);
+        op(@ins, 'unless_i', $r3, $done);
+        op(@ins, 'shift_o', $r4, $r1);
+        op(@ins, 'iterkey_s', $r2, $r1);
+        op(@ins, 'say', $r2);
+        op(@ins, 'goto', $walk);
+        nqp::push(@ins, $done);
+        op(@ins, 'return');
+    },
+    "k5\nk6\nk7\nk8\n",
+    "Iterator keeps its place when the deleted pairs dropped were the last");
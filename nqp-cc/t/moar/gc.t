@@ -1,7 +1,7 @@
 #!nqp
 use MASTTesting;
 
-plan(1);
+plan(4);
 
 mast_frame_output_is(-> $frame, @ins, $cu {
         my $r0 := local($frame, int);
@@ -20,3 +20,83 @@ mast_frame_output_is(-> $frame, @ins, $cu {
     },
     "0\n",
     "lived creating loads of objects (so we shoulda GC'd)");
+
+mast_frame_output_is(-> $frame, @ins, $cu {
+        my $r0 := local($frame, str);
+        my $i := 0;
+        while $i < 2000 {
+            op(@ins, 'const_s', $r0, sval("string constant $i"));
+            $i++;
+        }
+        op(@ins, 'say', $r0);
+        op(@ins, 'return');
+    },
+    "string constant 1999\n",
+    "loaded a unit with more string constants than fit in the nursery",
+    env => nqp::hash('MVM_GC_NURSERY_SIZE', '64K'));
+
+# Boxes enough integers in a 64K nursery to be sure of some GC runs.
+sub allocate_loads($frame, @ins) {
+    my $r0 := local($frame, NQPMu);
+    my $r1 := local($frame, NQPMu);
+    my $r2 := local($frame, int);
+    my $l0 := label('allocate');
+    op(@ins, 'hllboxtype_i', $r0);
+    op(@ins, 'const_i64', $r2, ival(100000));
+    nqp::push(@ins, $l0);
+    op(@ins, 'box_i', $r1, $r2, $r0);
+    op(@ins, 'dec_i', $r2);
+    op(@ins, 'if_i', $r2, $l0);
+}
+
+mast_frame_output_is(-> $frame, @ins, $cu {
+        my $r0 := local($frame, NQPMu);
+        my $r1 := local($frame, NQPMu);
+        my $r2 := local($frame, int);
+        my $r3 := local($frame, str);
+        allocate_loads($frame, @ins);
+        op(@ins, 'gcstats', $r0);
+        op(@ins, 'elems', $r2, $r0);
+        op(@ins, 'coerce_is', $r3, $r2);
+        op(@ins, 'say', $r3);
+        op(@ins, 'atkey_o', $r1, $r0, const($frame, sval('nursery_runs')));
+        op(@ins, 'unbox_i', $r2, $r1);
+        op(@ins, 'gt_i', $r2, $r2, const($frame, ival(0)));
+        op(@ins, 'coerce_is', $r3, $r2);
+        op(@ins, 'say', $r3);
+        op(@ins, 'atkey_o', $r1, $r0, const($frame, sval('pause_total_us')));
+        op(@ins, 'unbox_i', $r2, $r1);
+        op(@ins, 'ge_i', $r2, $r2, const($frame, ival(0)));
+        op(@ins, 'coerce_is', $r3, $r2);
+        op(@ins, 'say', $r3);
+        op(@ins, 'atkey_o', $r1, $r0, const($frame, sval('pauses')));
+        op(@ins, 'elems', $r2, $r1);
+        op(@ins, 'coerce_is', $r3, $r2);
+        op(@ins, 'say', $r3);
+        op(@ins, 'return');
+    },
+    "11\n1\n1\n20\n",
+    "gcstats counts GC runs",
+    env => nqp::hash('MVM_GC_NURSERY_SIZE', '64K'));
+
+mast_frame_output_is(-> $frame, @ins, $cu {
+        my $r0 := const($frame, sval('gclog.ignore'));
+        my $r1 := local($frame, str);
+        my $r2 := local($frame, int);
+        my $r3 := const($frame, ival(0));
+        my $r4 := local($frame, int);
+        allocate_loads($frame, @ins);
+        op(@ins, 'slurp', $r1, $r0, const($frame, sval('utf8')));
+        op(@ins, 'delete_f', $r0);
+        op(@ins, 'index_s', $r2, $r1, const($frame, sval('gc run=1 ')), $r3);
+        op(@ins, 'index_s', $r4, $r1, const($frame, sval(' kind=nursery ')), $r3);
+        op(@ins, 'coerce_is', $r1, $r2);
+        op(@ins, 'say', $r1);
+        op(@ins, 'gt_i', $r4, $r4, $r3);
+        op(@ins, 'coerce_is', $r1, $r4);
+        op(@ins, 'say', $r1);
+        op(@ins, 'return');
+    },
+    "0\n1\n",
+    "MVM_GC_LOG logs GC runs",
+    env => nqp::hash('MVM_GC_NURSERY_SIZE', '64K', 'MVM_GC_LOG', 'gclog.ignore'));
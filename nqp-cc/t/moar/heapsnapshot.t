@@ -0,0 +1,125 @@
+#!nqp
+use MASTTesting;
+
+plan(1);
+
+# Emits ops reading the 32-bit number at $offset bytes past $pos into
+# $result, from a snapshot read in as one character per byte. Snapshots
+# are in the byte order of the machine that wrote them, which we take to
+# be little endian.
+sub read_u32($frame, @ins, $result, $data, $pos, $offset) {
+    my $r0 := local($frame, int);
+    my $r1 := local($frame, int);
+    my $r2 := const($frame, ival(8));
+    op(@ins, 'const_i64', $result, ival(0));
+    for 3, 2, 1, 0 {
+        op(@ins, 'blshift_i', $result, $result, $r2);
+        op(@ins, 'const_i64', $r1, ival($offset + $_));
+        op(@ins, 'add_i', $r1, $r1, $pos);
+        op(@ins, 'ordat', $r0, $data, $r1);
+        op(@ins, 'bor_i', $result, $result, $r0);
+    }
+}
+
+mast_frame_output_is(-> $frame, @ins, $cu {
+        my $file   := const($frame, sval('temp.heapsnapshot'));
+        my $data   := local($frame, str);
+        my $str    := local($frame, str);
+        my $array  := local($frame, NQPMu);
+        my $box    := local($frame, NQPMu);
+        my $type   := local($frame, NQPMu);
+        my $pos    := local($frame, int);
+        my $len    := local($frame, int);
+        my $kind   := local($frame, int);
+        my $num    := local($frame, int);
+        my $test   := local($frame, int);
+        my $names  := const($frame, ival(0));
+        my $things := const($frame, ival(0));
+        my $roots  := const($frame, ival(0));
+        my $zero   := const($frame, ival(0));
+        my $fill   := label('fill');
+        my $walk   := label('walk');
+        my $name   := label('name');
+        my $thing  := label('thing');
+        my $root   := label('root');
+        my $end    := label('end');
+        my $bad    := label('bad');
+
+        # Keep a thousand boxed integers alive, and take a snapshot.
+        op(@ins, 'hllboxtype_i', $type);
+        op(@ins, 'bootarray', $array);
+        op(@ins, 'create', $array, $array);
+        op(@ins, 'const_i64', $num, ival(1000));
+        nqp::push(@ins, $fill);
+        op(@ins, 'box_i', $box, $num, $type);
+        op(@ins, 'push_o', $array, $box);
+        op(@ins, 'dec_i', $num);
+        op(@ins, 'if_i', $num, $fill);
+        op(@ins, 'heapsnapshot', $file);
+        op(@ins, 'slurp', $data, $file, const($frame, sval('iso-8859-1')));
+        op(@ins, 'delete_f', $file);
+
+        # Check the header, then walk the records up to the end one.
+        op(@ins, 'substr_s', $str, $data, $zero, const($frame, ival(8)));
+        op(@ins, 'say', $str);
+        op(@ins, 'chars', $len, $data);
+        op(@ins, 'const_i64', $pos, ival(8));
+        nqp::push(@ins, $walk);
+        op(@ins, 'ge_i', $test, $pos, $len);
+        op(@ins, 'if_i', $test, $bad);
+        op(@ins, 'ordat', $kind, $data, $pos);
+        op(@ins, 'inc_i', $pos);
+        for [110, $name], [111, $thing], [114, $root], [101, $end] {
+            op(@ins, 'eq_i', $test, $kind, const($frame, ival($_[0])));
+            op(@ins, 'if_i', $test, $_[1]);
+        }
+        op(@ins, 'goto', $bad);
+
+        # A name: number, length, and that many bytes.
+        nqp::push(@ins, $name);
+        read_u32($frame, @ins, $num, $data, $pos, 4);
+        op(@ins, 'add_i', $pos, $pos, $num);
+        op(@ins, 'add_i', $pos, $pos, const($frame, ival(8)));
+        op(@ins, 'inc_i', $names);
+        op(@ins, 'goto', $walk);
+
+        # A thing: 17 bytes, ending with the number of references, and
+        # then the references.
+        nqp::push(@ins, $thing);
+        read_u32($frame, @ins, $num, $data, $pos, 13);
+        op(@ins, 'mul_i', $num, $num, const($frame, ival(4)));
+        op(@ins, 'add_i', $pos, $pos, $num);
+        op(@ins, 'add_i', $pos, $pos, const($frame, ival(17)));
+        op(@ins, 'inc_i', $things);
+        op(@ins, 'goto', $walk);
+
+        # A root: 9 bytes.
+        nqp::push(@ins, $root);
+        op(@ins, 'add_i', $pos, $pos, const($frame, ival(9)));
+        op(@ins, 'inc_i', $roots);
+        op(@ins, 'goto', $walk);
+
+        nqp::push(@ins, $bad);
+        op(@ins, 'const_s', $str, sval('malformed snapshot'));
+        op(@ins, 'say', $str);
+        op(@ins, 'return');
+
+        # The end record must be the last byte. There must be names, roots,
+        # and at least as many things as the boxes we kept.
+        nqp::push(@ins, $end);
+        op(@ins, 'eq_i', $test, $pos, $len);
+        op(@ins, 'coerce_is', $str, $test);
+        op(@ins, 'say', $str);
+        op(@ins, 'gt_i', $test, $names, $zero);
+        op(@ins, 'coerce_is', $str, $test);
+        op(@ins, 'say', $str);
+        op(@ins, 'gt_i', $test, $roots, $zero);
+        op(@ins, 'coerce_is', $str, $test);
+        op(@ins, 'say', $str);
+        op(@ins, 'ge_i', $test, $things, const($frame, ival(1000)));
+        op(@ins, 'coerce_is', $str, $test);
+        op(@ins, 'say', $str);
+        op(@ins, 'return');
+    },
+    "MVMHEAP1\n1\n1\n1\n1\n",
+    "heap snapshot is well formed and has the things kept alive");
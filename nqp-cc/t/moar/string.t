@@ -1,7 +1,32 @@
 #!nqp
 use MASTTesting;
 
-plan(40);
+plan(50);
+
+# Emits a loop that builds a string from the empty one, with the ops &step
+# emits for each of $n numbers from 0 on, then says whether the string is
+# $expected and how long it is.
+sub build_string($frame, @ins, $n, &step, $expected) {
+    my $s     := local($frame, str);
+    my $piece := local($frame, str);
+    my $i     := local($frame, int);
+    my $test  := local($frame, int);
+    my $loop  := label('loop');
+    op(@ins, 'const_s', $s, sval(''));
+    op(@ins, 'const_i64', $i, ival(0));
+    nqp::push(@ins, $loop);
+    op(@ins, 'coerce_is', $piece, $i);
+    step($s, $piece, $i, $test);
+    op(@ins, 'inc_i', $i);
+    op(@ins, 'lt_i', $test, $i, const($frame, ival($n)));
+    op(@ins, 'if_i', $test, $loop);
+    op(@ins, 'eq_s', $test, $s, const($frame, sval($expected)));
+    op(@ins, 'coerce_is', $piece, $test);
+    op(@ins, 'say', $piece);
+    op(@ins, 'chars', $test, $s);
+    op(@ins, 'coerce_is', $piece, $test);
+    op(@ins, 'say', $piece);
+}
 
 mast_frame_output_is(-> $frame, @ins, $cu {
         my $r0 := local($frame, str);
@@ -166,6 +191,32 @@ mast_frame_output_is(-> $frame, @ins, $cu {
     "1\n",
     "string equal");
 
+mast_frame_output_is(-> $frame, @ins, $cu {
+        my $r0 := local($frame, str);
+        my $r1 := local($frame, str);
+        my $r2 := local($frame, int);
+        my $r3 := local($frame, str);
+        sub say_eq($s, $other) {
+            op(@ins, 'eq_s', $r2, $s, const($frame, sval($other)));
+            op(@ins, 'coerce_is', $r3, $r2);
+            op(@ins, 'say', $r3);
+        }
+        op(@ins, 'const_s', $r0, sval(nqp::x('a', 20)));
+        op(@ins, 'const_s', $r1, sval(nqp::x('b', 20)));
+        op(@ins, 'concat_s', $r0, $r0, $r1);
+        say_eq($r0, nqp::x('a', 20) ~ nqp::x('b', 19) ~ 'c');
+        say_eq($r0, nqp::x('a', 19) ~ 'Ж' ~ nqp::x('b', 20));
+        say_eq($r0, nqp::x('a', 20) ~ nqp::x('b', 20));
+        op(@ins, 'const_i64', $r2, ival(1234567890));
+        op(@ins, 'coerce_is', $r1, $r2);
+        op(@ins, 'concat_s', $r0, $r0, $r1);
+        say_eq($r0, nqp::x('a', 20) ~ nqp::x('b', 20) ~ '1234567891');
+        say_eq($r0, nqp::x('a', 20) ~ nqp::x('b', 20) ~ '1234567890');
+        op(@ins, 'return');
+    },
+    "0\n0\n1\n0\n1\n",
+    "string equal over ropes");
+
 mast_frame_output_is(-> $frame, @ins, $cu {
         my $r0 := local($frame, str);
         my $r1 := local($frame, str);
@@ -557,3 +608,255 @@ mast_frame_output_is(-> $frame, @ins, $cu {
     "BARBARBARBARBARBARBARBARBARBARBARBARBARBARBARBAR\n"~
     "BARBARBARBARBARBARBARBARBARBARBARBARBARBARBARBAR\n1\n",
     "equals of tree of UPPERed string tree");
+
+mast_frame_output_is(-> $frame, @ins, $cu {
+        my $r0 := local($frame, str);
+        my $r1 := local($frame, str);
+        my $r2 := local($frame, int);
+        for ['index_s', 'aaaaaaab', 'aab', 0],
+            ['index_s', 'ababab', 'abab', 1],
+            ['index_s', 'ababab', 'abab', 3],
+            ['index_s', 'abacabad abacabac', 'abacabac', 0],
+            ['index_s', 'a needle in needles', 'needle', 3],
+            ['rindexfrom', 'ababab', 'abab', -1],
+            ['rindexfrom', 'aabaabaab', 'aab', 5],
+            ['rindexfrom', 'baaaaaaa', 'baa', -1],
+            ['rindexfrom', 'a needle in needles', 'needle', -1] {
+            op(@ins, 'const_s', $r0, sval($_[1]));
+            op(@ins, 'const_s', $r1, sval($_[2]));
+            op(@ins, $_[0], $r2, $r0, $r1, const($frame, ival($_[3])));
+            op(@ins, 'coerce_is', $r0, $r2);
+            op(@ins, 'say', $r0);
+        }
+        op(@ins, 'return');
+    },
+    "5\n2\n-1\n9\n12\n2\n3\n0\n12\n",
+    "string index and rindex with periodic and non-periodic needles");
+
+mast_frame_output_is(-> $frame, @ins, $cu {
+        my $wide := const($frame, sval('Жabcdefghijklmnopqrstuvwxyz!?Ж'));
+        my $h8   := local($frame, str);
+        my $hay  := local($frame, str);
+        my $n1   := local($frame, str);
+        my $n8   := local($frame, str);
+        my $r0   := local($frame, str);
+        my $r1   := local($frame, int);
+        # 8-bit digits, then wide letters, then the digits again; the
+        # needle is a rope of the end of the digits and the letters.
+        op(@ins, 'coerce_is', $h8, const($frame, ival(1234567890)));
+        op(@ins, 'concat_s', $hay, $h8, $wide);
+        op(@ins, 'concat_s', $hay, $hay, $h8);
+        op(@ins, 'coerce_is', $n1, const($frame, ival(7890)));
+        op(@ins, 'concat_s', $n1, $n1, $wide);
+        op(@ins, 'coerce_is', $n8, const($frame, ival(90)));
+        op(@ins, 'index_s', $r1, $hay, $n1, const($frame, ival(0)));
+        op(@ins, 'coerce_is', $r0, $r1);
+        op(@ins, 'say', $r0);
+        op(@ins, 'rindexfrom', $r1, $hay, $n1, const($frame, ival(-1)));
+        op(@ins, 'coerce_is', $r0, $r1);
+        op(@ins, 'say', $r0);
+        op(@ins, 'index_s', $r1, $hay, const($frame, sval('Ж123')), const($frame, ival(0)));
+        op(@ins, 'coerce_is', $r0, $r1);
+        op(@ins, 'say', $r0);
+        op(@ins, 'index_s', $r1, $hay, $n8, const($frame, ival(12)));
+        op(@ins, 'coerce_is', $r0, $r1);
+        op(@ins, 'say', $r0);
+        op(@ins, 'rindexfrom', $r1, $hay, const($frame, sval('90')), const($frame, ival(-1)));
+        op(@ins, 'coerce_is', $r0, $r1);
+        op(@ins, 'say', $r0);
+        op(@ins, 'rindexfrom', $r1, $hay, $n8, const($frame, ival(47)));
+        op(@ins, 'coerce_is', $r0, $r1);
+        op(@ins, 'say', $r0);
+        op(@ins, 'index_s', $r1, $h8, const($frame, sval('Ж')), const($frame, ival(0)));
+        op(@ins, 'coerce_is', $r0, $r1);
+        op(@ins, 'say', $r0);
+        op(@ins, 'return');
+    },
+    "6\n6\n39\n48\n48\n8\n-1\n",
+    "string index and rindex in ropes of 8-bit and 32-bit strings");
+
+mast_frame_output_is(-> $frame, @ins, $cu {
+        my $hay := const($frame, sval('foobarbaz'));
+        my $r0  := local($frame, str);
+        my $r1  := local($frame, int);
+        for ['baz', 8], ['bar', 7], ['foo', 8], ['z', 8], ['baz', 5] {
+            op(@ins, 'rindexfrom', $r1, $hay, const($frame, sval($_[0])), const($frame, ival($_[1])));
+            op(@ins, 'coerce_is', $r0, $r1);
+            op(@ins, 'say', $r0);
+        }
+        op(@ins, 'return');
+    },
+    "6\n3\n0\n8\n-1\n",
+    "string rindex from nearer the end than the needle is long");
+
+mast_frame_output_is(-> $frame, @ins, $cu {
+        my $arr   := local($frame, NQPMu);
+        my $input := local($frame, str);
+        my $str   := local($frame, str);
+        my $elems := local($frame, int);
+        my $bar   := const($frame, sval('|'));
+        sub split_and_show($separator) {
+            op(@ins, 'split', $arr, const($frame, sval($separator)), $input);
+            op(@ins, 'elems', $elems, $arr);
+            op(@ins, 'coerce_is', $str, $elems);
+            op(@ins, 'say', $str);
+            op(@ins, 'join', $str, $bar, $arr);
+            op(@ins, 'say', $str);
+        }
+        op(@ins, 'const_s', $input, sval('a--b----c--'));
+        split_and_show('--');
+        op(@ins, 'const_s', $input, sval('aaaaa'));
+        split_and_show('aa');
+        op(@ins, 'repeat_s', $input, const($frame, sval('Ж----')), const($frame, ival(5)));
+        op(@ins, 'coerce_is', $str, const($frame, ival(1234567890)));
+        op(@ins, 'concat_s', $input, $input, $str);
+        split_and_show('--');
+        op(@ins, 'return');
+    },
+    "5\na|b||c|\n3\n||a\n11\nЖ||Ж||Ж||Ж||Ж||1234567890\n",
+    "string split with separators next to each other");
+
+{
+    my $expected := '';
+    my $i := 0;
+    while $i < 1000 {
+        $expected := $expected ~ $i;
+        $i++;
+    }
+    mast_frame_output_is(-> $frame, @ins, $cu {
+            build_string($frame, @ins, 1000, -> $s, $piece, $i, $test {
+                op(@ins, 'concat_s', $s, $s, $piece);
+            }, $expected);
+            op(@ins, 'return');
+        },
+        "1\n2890\n",
+        "string built by a long chain of appends");
+}
+
+{
+    my $expected := '';
+    my $i := 0;
+    while $i < 1000 {
+        $expected := $i ~ $expected;
+        $i++;
+    }
+    mast_frame_output_is(-> $frame, @ins, $cu {
+            build_string($frame, @ins, 1000, -> $s, $piece, $i, $test {
+                op(@ins, 'concat_s', $s, $piece, $s);
+            }, $expected);
+            op(@ins, 'return');
+        },
+        "1\n2890\n",
+        "string built by a long chain of prepends");
+}
+
+{
+    my $expected := '';
+    my $i := 0;
+    while $i < 600 {
+        $expected := $i % 2 ?? 'Ж' ~ $expected ~ $i !! $i ~ $expected ~ 'Жж';
+        $i++;
+    }
+    mast_frame_output_is(-> $frame, @ins, $cu {
+            my $even := label('even');
+            my $next := label('next');
+            # The numbers are 8-bit strings, the letters 32-bit ones.
+            build_string($frame, @ins, 600, -> $s, $piece, $i, $test {
+                op(@ins, 'mod_i', $test, $i, const($frame, ival(2)));
+                op(@ins, 'unless_i', $test, $even);
+                op(@ins, 'concat_s', $s, $s, $piece);
+                op(@ins, 'concat_s', $s, const($frame, sval('Ж')), $s);
+                op(@ins, 'goto', $next);
+                nqp::push(@ins, $even);
+                op(@ins, 'concat_s', $s, $piece, $s);
+                op(@ins, 'concat_s', $s, $s, const($frame, sval('Жж')));
+                nqp::push(@ins, $next);
+            }, $expected);
+            op(@ins, 'return');
+        },
+        "1\n2590\n",
+        "string built by appends and prepends of 8-bit and 32-bit strings");
+}
+
+mast_frame_output_is(-> $frame, @ins, $cu {
+        my $digits := local($frame, str);
+        my $flat   := local($frame, str);
+        my $rope   := local($frame, str);
+        my $pre    := local($frame, str);
+        my $r0     := local($frame, str);
+        my $r1     := local($frame, int);
+        sub say_eq($s, $expected) {
+            op(@ins, 'eq_s', $r1, $s, const($frame, sval($expected)));
+            op(@ins, 'coerce_is', $r0, $r1);
+            op(@ins, 'say', $r0);
+        }
+        sub say_ord($s, $index) {
+            op(@ins, 'ordat', $r1, $s, const($frame, ival($index)));
+            op(@ins, 'coerce_is', $r0, $r1);
+            op(@ins, 'say', $r0);
+        }
+        # 19 8-bit digits and 13 letters make 32, which is still flat; one
+        # more, appended or prepended, makes a rope.
+        op(@ins, 'coerce_is', $digits, const($frame, ival(1234567890123456789)));
+        op(@ins, 'concat_s', $flat, $digits, const($frame, sval('abcdefghijklm')));
+        say_eq($flat, '1234567890123456789abcdefghijklm');
+        op(@ins, 'concat_s', $rope, $flat, const($frame, sval('Ж')));
+        say_eq($rope, '1234567890123456789abcdefghijklmЖ');
+        say_ord($rope, 31);
+        say_ord($rope, 32);
+        op(@ins, 'concat_s', $pre, const($frame, sval('Ж')), $flat);
+        say_eq($pre, 'Ж1234567890123456789abcdefghijklm');
+        say_ord($pre, 0);
+        say_ord($pre, 1);
+        # Part of the rope and one more make 32 again.
+        op(@ins, 'substr_s', $r0, $rope, const($frame, ival(1)), const($frame, ival(31)));
+        op(@ins, 'concat_s', $flat, $r0, const($frame, sval('é')));
+        say_eq($flat, '234567890123456789abcdefghijklmé');
+        say_ord($flat, 31);
+        op(@ins, 'return');
+    },
+    "1\n1\n109\n1046\n1\n1046\n49\n1\n233\n",
+    "string concatenation either side of the flattening limit");
+
+{
+    my $piece := 'abcdefghiЖ';
+    my $full := nqp::substr(nqp::x($piece, 3000), 3000);
+    mast_frame_output_is(-> $frame, @ins, $cu {
+            my $s    := local($frame, str);
+            my $sub  := local($frame, str);
+            my $i    := local($frame, int);
+            my $r0   := local($frame, str);
+            my $r1   := local($frame, int);
+            my $loop := label('loop');
+            # Appending and dropping the first character each time makes a
+            # rope deep enough to be rebuilt, again and again.
+            op(@ins, 'const_s', $s, sval(''));
+            op(@ins, 'const_i64', $i, ival(0));
+            nqp::push(@ins, $loop);
+            op(@ins, 'concat_s', $s, $s, const($frame, sval($piece)));
+            op(@ins, 'substr_s', $s, $s, const($frame, ival(1)), const($frame, ival(-1)));
+            op(@ins, 'inc_i', $i);
+            op(@ins, 'lt_i', $r1, $i, const($frame, ival(3000)));
+            op(@ins, 'if_i', $r1, $loop);
+            op(@ins, 'eq_s', $r1, $s, const($frame, sval($full)));
+            op(@ins, 'coerce_is', $r0, $r1);
+            op(@ins, 'say', $r0);
+            for [0, 10], [12345, 40], [26990, 10] {
+                op(@ins, 'substr_s', $sub, $s, const($frame, ival($_[0])), const($frame, ival($_[1])));
+                op(@ins, 'eq_s', $r1, $sub, const($frame, sval(nqp::substr($full, $_[0], $_[1]))));
+                op(@ins, 'coerce_is', $r0, $r1);
+                op(@ins, 'say', $r0);
+            }
+            op(@ins, 'substr_s', $sub, $s, const($frame, ival(12345)), const($frame, ival(100)));
+            op(@ins, 'substr_s', $sub, $sub, const($frame, ival(5)), const($frame, ival(20)));
+            op(@ins, 'eq_s', $r1, $sub, const($frame, sval(nqp::substr($full, 12350, 20))));
+            op(@ins, 'coerce_is', $r0, $r1);
+            op(@ins, 'say', $r0);
+            op(@ins, 'ordat', $r1, $sub, const($frame, ival(4)));
+            op(@ins, 'coerce_is', $r0, $r1);
+            op(@ins, 'say', $r0);
+            op(@ins, 'return');
+        },
+        "1\n1\n1\n1\n1\n" ~ nqp::ord(nqp::substr($full, 12354, 1)) ~ "\n",
+        "substrings of a deep rope");
+}
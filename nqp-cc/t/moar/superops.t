@@ -0,0 +1,187 @@
+#!nqp
+use MASTTesting;
+
+plan(6);
+
+# The pre-decoder fuses the sequences of ops below into superinstructions;
+# these check they still do what the ops would, including when a branch
+# lands in the middle of a sequence.
+
+# Emits a comparison of each pair of numbers, branching with $branch on
+# the result, and says whether the branch was taken.
+sub compare_and_branch($frame, @ins, $branch, @pairs) {
+    my $a := local($frame, int);
+    my $b := local($frame, int);
+    my $t := local($frame, int);
+    my $s := local($frame, str);
+    my $n := 0;
+    for @pairs -> $pair {
+        my $taken := label('taken' ~ $n);
+        my $done  := label('done' ~ $n);
+        $n := $n + 1;
+        op(@ins, 'const_i64', $a, ival($pair[0]));
+        op(@ins, 'const_i64', $b, ival($pair[1]));
+        op(@ins, 'lt_i', $t, $a, $b);
+        op(@ins, $branch, $t, $taken);
+        op(@ins, 'const_s', $s, sval('no'));
+        op(@ins, 'goto', $done);
+        nqp::push(@ins, $taken);
+        op(@ins, 'const_s', $s, sval('yes'));
+        nqp::push(@ins, $done);
+        op(@ins, 'say', $s);
+    }
+}
+
+mast_frame_output_is(-> $frame, @ins, $cu {
+        compare_and_branch($frame, @ins, 'if_i', [[1, 2], [2, 1], [2, 2], [-5, 3]]);
+        op(@ins, 'return');
+    },
+    "yes\nno\nno\nyes\n",
+    "lt_i followed by if_i");
+
+mast_frame_output_is(-> $frame, @ins, $cu {
+        compare_and_branch($frame, @ins, 'unless_i', [[1, 2], [2, 1], [2, 2], [-5, 3]]);
+        op(@ins, 'return');
+    },
+    "no\nyes\nyes\nno\n",
+    "lt_i followed by unless_i");
+
+mast_frame_output_is(-> $frame, @ins, $cu {
+        my $a := local($frame, int);
+        my $b := local($frame, int);
+        my $again := local($frame, int);
+        my $s := local($frame, str);
+        my $top := label('top');
+        my $add := label('add');
+        my $end := label('end');
+        op(@ins, 'const_i64', $a, ival(10));
+        op(@ins, 'const_i64', $b, ival(100));
+        op(@ins, 'const_i64', $again, ival(0));
+        op(@ins, 'goto', $add);
+        nqp::push(@ins, $top);
+        op(@ins, 'const_i64', $b, ival(-7));
+        nqp::push(@ins, $add);
+        op(@ins, 'add_i', $a, $a, $b);
+        op(@ins, 'coerce_is', $s, $a);
+        op(@ins, 'say', $s);
+        op(@ins, 'if_i', $again, $end);
+        op(@ins, 'const_i64', $again, ival(1));
+        op(@ins, 'goto', $top);
+        nqp::push(@ins, $end);
+        op(@ins, 'return');
+    },
+    "110\n103\n",
+    "const_i64 followed by add_i, also entered at the add_i");
+
+mast_frame_output_is(-> $frame, @ins, $cu {
+        my $i := local($frame, int);
+        my $n := local($frame, int);
+        my $step := local($frame, int);
+        my $t := local($frame, int);
+        my $s := local($frame, str);
+        my $loop := label('loop');
+        my $check := label('check');
+        my $done := label('done');
+        op(@ins, 'const_i64', $i, ival(0));
+        op(@ins, 'const_i64', $n, ival(5));
+        op(@ins, 'goto', $check);
+        nqp::push(@ins, $loop);
+        op(@ins, 'coerce_is', $s, $i);
+        op(@ins, 'say', $s);
+        op(@ins, 'const_i64', $step, ival(2));
+        op(@ins, 'add_i', $i, $i, $step);
+        nqp::push(@ins, $check);
+        op(@ins, 'lt_i', $t, $i, $n);
+        op(@ins, 'unless_i', $t, $done);
+        op(@ins, 'goto', $loop);
+        nqp::push(@ins, $done);
+        op(@ins, 'coerce_is', $s, $i);
+        op(@ins, 'say', $s);
+        op(@ins, 'coerce_is', $s, $t);
+        op(@ins, 'say', $s);
+        op(@ins, 'return');
+    },
+    "0\n2\n4\n6\n0\n",
+    "const_i64, add_i, lt_i and unless_i, first entered at the lt_i");
+
+mast_frame_output_is(-> $frame, @ins, $cu {
+        my $lex := lexical($frame, NQPMu, '$how');
+        my $kh := local($frame, NQPMu);
+        my $how := local($frame, NQPMu);
+        my $attr := local($frame, NQPMu);
+        my $r0 := local($frame, NQPMu);
+        my $r1 := local($frame, NQPMu);
+        my $t := local($frame, int);
+        my $s := local($frame, str);
+        my $at_decont := label('at_decont');
+        my $end := label('end');
+        op(@ins, 'knowhow', $kh);
+        op(@ins, 'gethow', $how, $kh);
+        op(@ins, 'knowhowattr', $attr);
+        op(@ins, 'bindlex', $lex, $how);
+        op(@ins, 'getlex', $r0, $lex);
+        nqp::push(@ins, $at_decont);
+        op(@ins, 'decont', $r1, $r0);
+        op(@ins, 'eqaddr', $t, $r1, $how);
+        op(@ins, 'coerce_is', $s, $t);
+        op(@ins, 'say', $s);
+        op(@ins, 'unless_i', $t, $end);
+        op(@ins, 'set', $r0, $attr);
+        op(@ins, 'goto', $at_decont);
+        nqp::push(@ins, $end);
+        op(@ins, 'return');
+    },
+    "1\n0\n",
+    "getlex followed by decont, also entered at the decont");
+
+mast_frame_output_is(-> $frame, @ins, $cu {
+        my $lex := lexical($frame, NQPMu, '$how');
+        my $kh := local($frame, NQPMu);
+        my $how := local($frame, NQPMu);
+        my $attr := local($frame, NQPMu);
+        my $r0 := local($frame, NQPMu);
+        my $r1 := local($frame, NQPMu);
+        my $meth := local($frame, NQPMu);
+        my $expected := local($frame, NQPMu);
+        my $pass := local($frame, int);
+        my $t := local($frame, int);
+        my $s := local($frame, str);
+        my $at_decont := label('at_decont');
+        my $at_findmeth := label('at_findmeth');
+        my $second := label('second');
+        my $third := label('third');
+        my $done := label('done');
+        op(@ins, 'knowhow', $kh);
+        op(@ins, 'gethow', $how, $kh);
+        op(@ins, 'knowhowattr', $attr);
+        op(@ins, 'findmeth', $expected, $how, sval('name'));
+        op(@ins, 'bindlex', $lex, $how);
+        op(@ins, 'const_i64', $pass, ival(0));
+        op(@ins, 'getlex', $r0, $lex);
+        nqp::push(@ins, $at_decont);
+        op(@ins, 'decont', $r1, $r0);
+        nqp::push(@ins, $at_findmeth);
+        op(@ins, 'findmeth', $meth, $r1, sval('name'));
+        op(@ins, 'eqaddr', $t, $meth, $expected);
+        op(@ins, 'coerce_is', $s, $t);
+        op(@ins, 'say', $s);
+        op(@ins, 'inc_i', $pass);
+        op(@ins, 'eq_i', $t, $pass, const($frame, ival(1)));
+        op(@ins, 'if_i', $t, $second);
+        op(@ins, 'eq_i', $t, $pass, const($frame, ival(2)));
+        op(@ins, 'if_i', $t, $third);
+        op(@ins, 'goto', $done);
+        nqp::push(@ins, $second);
+        op(@ins, 'set', $r0, $attr);
+        op(@ins, 'goto', $at_decont);
+        nqp::push(@ins, $third);
+        op(@ins, 'set', $r0, $how);
+        op(@ins, 'set', $r1, $attr);
+        op(@ins, 'goto', $at_findmeth);
+        nqp::push(@ins, $done);
+        call(@ins, $expected, [$Arg::obj, $Arg::obj], $how, $kh, :result($s));
+        op(@ins, 'say', $s);
+        op(@ins, 'return');
+    },
+    "1\n0\n0\nKnowHOW\n",
+    "getlex, decont and findmeth, also entered at the decont and the findmeth");
@@ -87,7 +87,19 @@ typedef enum {
 
     /* Has already been added to the gen2 aggregates pointing to nursery
      * objects list. */
-    MVM_CF_IN_GEN2_ROOT_LIST = 32
+    MVM_CF_IN_GEN2_ROOT_LIST = 32,
+
+    /* Keeps a card table, but every card is to be scanned the next time
+     * its gen2 roots are, since the table can't be trusted. */
+    MVM_CF_SCAN_ALL_CARDS = 64,
+
+    /* Lives in the large object space of the second generation, so it is
+     * marked in a side table rather than through its forwarder. */
+    MVM_CF_LARGE_OBJECT = 128,
+
+    /* Lives in a gen2 page that a full collection is emptying, so it is to
+     * be moved elsewhere if it's found alive. */
+    MVM_CF_EVACUATE = 256
 } MVMCollectableFlags;
 
 /* Things that every GC-collectable entity has. These fall into two
@@ -454,6 +466,13 @@ struct MVMREPROps {
     /* MoarVM-specific REPR API addition used to free an object. */
     void (*gc_free) (MVMThreadContext *tc, MVMObject *object);
 
+    /* MoarVM-specific REPR API addition for objects that keep a card table.
+     * Used in place of gc_mark when the object is in generation 2 and is a
+     * root of a nursery collection; adds only the pointers in dirty cards
+     * (or in all cards, if all is set) to the worklist. Returns non-zero
+     * if any card is still dirty. */
+    MVMuint32 (*gc_mark_cards) (MVMThreadContext *tc, MVMSTable *st, void *data, MVMGCWorklist *worklist, MVMuint32 all);
+
     /* This is called to do any cleanup of resources when an object gets
      * embedded inside another one. Never called on a top-level object. */
     void (*gc_cleanup) (MVMThreadContext *tc, MVMSTable *st, void *data);
@@ -478,6 +497,11 @@ struct MVMREPROps {
     /* Does this representation reference frames (either MVMStaticFrame or
      * MVMFrame)? */
     MVMuint32 refs_frames;
+
+    /* Is allocate just MVM_gc_allocate_object, so that an instance is st->size
+     * zeroed bytes with the header and STable filled in (or an exception, if
+     * st->size is 0)? If so, the interpreter may allocate instances itself. */
+    MVMuint32 fixed_size;
 };
 
 /* Various handy macros for getting at important stuff. */
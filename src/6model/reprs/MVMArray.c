@@ -48,6 +48,7 @@ static void copy_to(MVMThreadContext *tc, MVMSTable *st, void *src, MVMObject *d
     dest_body->elems = src_body->elems;
     dest_body->ssize = src_body->elems;
     dest_body->start = 0;
+    dest_body->cards = NULL;
     if (dest_body->elems > 0) {
         size_t  mem_size     = dest_body->ssize * repr_data->elem_size;
         size_t  start_pos    = src_body->start * repr_data->elem_size;
@@ -89,6 +90,16 @@ static void gc_mark(MVMThreadContext *tc, MVMSTable *st, void *data, MVMGCWorkli
     }
 }
 
+/* Adds held objects in dirty cards to the GC worklist. */
+static MVMuint32 gc_mark_cards(MVMThreadContext *tc, MVMSTable *st, void *data, MVMGCWorklist *worklist, MVMuint32 all) {
+    MVMArrayREPRData *repr_data = (MVMArrayREPRData *)st->REPR_data;
+    MVMArrayBody     *body      = (MVMArrayBody *)data;
+    if (repr_data->slot_type != MVM_ARRAY_OBJ && repr_data->slot_type != MVM_ARRAY_STR)
+        return 0;
+    return MVM_gc_card_mark_slots(tc, &body->cards, (MVMCollectable **)body->slots.any,
+        body->start, body->start + body->elems, all, worklist);
+}
+
 /* Called by the VM in order to free memory associated with this object. */
 static void gc_free(MVMThreadContext *tc, MVMObject *obj) {
     MVMArray *arr = (MVMArray *)obj;
@@ -96,6 +107,7 @@ static void gc_free(MVMThreadContext *tc, MVMObject *obj) {
         free(arr->body.slots.any);
         arr->body.slots.any = NULL;
     }
+    MVM_gc_card_table_free(tc, &arr->body.cards);
 }
 
 /* Gets the storage specification for this representation. */
@@ -230,7 +242,7 @@ static MVMuint64 zero_slots(MVMThreadContext *tc, MVMArrayBody *body,
     return elems;
 }
 
-static void set_size_internal(MVMThreadContext *tc, MVMArrayBody *body, MVMint64 n, MVMArrayREPRData *repr_data) {
+static void set_size_internal(MVMThreadContext *tc, MVMObject *root, MVMArrayBody *body, MVMint64 n, MVMArrayREPRData *repr_data) {
     MVMuint64   elems = body->elems;
     MVMuint64   start = body->start;
     MVMuint64   ssize = body->ssize;
@@ -246,10 +258,12 @@ static void set_size_internal(MVMThreadContext *tc, MVMArrayBody *body, MVMint64
     /* if there aren't enough slots at the end, shift off empty slots
      * from the beginning first */
     if (start > 0 && n + start > ssize) {
-        if (elems > 0)
+        if (elems > 0) {
             memmove(slots,
                 (char *)slots + start * repr_data->elem_size,
                 elems * repr_data->elem_size);
+            MVM_gc_card_mark_all(tc, (MVMCollectable *)root);
+        }
         body->start = 0;
         /* fill out any unused slots with NULL pointers or zero values */
         elems = zero_slots(tc, body, elems, ssize, repr_data->slot_type);
@@ -297,19 +311,21 @@ static void bind_pos(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void
             MVM_exception_throw_adhoc(tc, "MVMArray: Index out of bounds");
     }
     else if (index >= body->elems)
-        set_size_internal(tc, body, index + 1, repr_data);
+        set_size_internal(tc, root, body, index + 1, repr_data);
 
     /* Go by type. */
     switch (repr_data->slot_type) {
         case MVM_ARRAY_OBJ:
             if (kind != MVM_reg_obj)
                 MVM_exception_throw_adhoc(tc, "MVMArray: bindpos expected object register");
-            MVM_ASSIGN_REF(tc, root, body->slots.o[body->start + index], value.o);
+            MVM_ASSIGN_REF_CARD(tc, root, &body->cards, body->start + index,
+                body->slots.o[body->start + index], value.o);
             break;
         case MVM_ARRAY_STR:
             if (kind != MVM_reg_str)
                 MVM_exception_throw_adhoc(tc, "MVMArray: bindpos expected string register");
-            MVM_ASSIGN_REF(tc, root, body->slots.s[body->start + index], value.s);
+            MVM_ASSIGN_REF_CARD(tc, root, &body->cards, body->start + index,
+                body->slots.s[body->start + index], value.s);
             break;
         case MVM_ARRAY_I64:
             if (kind != MVM_reg_int64)
@@ -354,7 +370,7 @@ static MVMuint64 elems(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, voi
 static void set_elems(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data, MVMuint64 count) {
     MVMArrayREPRData *repr_data = (MVMArrayREPRData *)st->REPR_data;
     MVMArrayBody     *body      = (MVMArrayBody *)data;
-    set_size_internal(tc, body, count, repr_data);
+    set_size_internal(tc, root, body, count, repr_data);
 }
 
 MVMint64 exists_pos(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data, MVMint64 index) {
@@ -375,17 +391,19 @@ MVMint64 exists_pos(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *
 static void push(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data, MVMRegister value, MVMuint16 kind) {
     MVMArrayBody     *body      = (MVMArrayBody *)data;
     MVMArrayREPRData *repr_data = (MVMArrayREPRData *)st->REPR_data;
-    set_size_internal(tc, body, body->elems + 1, repr_data);
+    set_size_internal(tc, root, body, body->elems + 1, repr_data);
     switch (repr_data->slot_type) {
         case MVM_ARRAY_OBJ:
             if (kind != MVM_reg_obj)
                 MVM_exception_throw_adhoc(tc, "MVMArray: push expected object register");
-            MVM_ASSIGN_REF(tc, root, body->slots.o[body->start + body->elems - 1], value.o);
+            MVM_ASSIGN_REF_CARD(tc, root, &body->cards, body->start + body->elems - 1,
+                body->slots.o[body->start + body->elems - 1], value.o);
             break;
         case MVM_ARRAY_STR:
             if (kind != MVM_reg_str)
                 MVM_exception_throw_adhoc(tc, "MVMArray: push expected string register");
-            MVM_ASSIGN_REF(tc, root, body->slots.s[body->start + body->elems - 1], value.s);
+            MVM_ASSIGN_REF_CARD(tc, root, &body->cards, body->start + body->elems - 1,
+                body->slots.s[body->start + body->elems - 1], value.s);
             break;
         case MVM_ARRAY_I64:
             if (kind != MVM_reg_int64)
@@ -489,13 +507,14 @@ static void unshift(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *
         MVMuint64 i;
 
         /* grow the array */
-        set_size_internal(tc, body, elems + n, repr_data);
+        set_size_internal(tc, root, body, elems + n, repr_data);
 
         /* move elements and set start */
         memmove(
             (char *)body->slots.any + n * repr_data->elem_size,
             body->slots.any,
             elems * repr_data->elem_size);
+        MVM_gc_card_mark_all(tc, (MVMCollectable *)root);
         body->start = n;
         body->elems = elems;
 
@@ -509,12 +528,14 @@ static void unshift(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *
         case MVM_ARRAY_OBJ:
             if (kind != MVM_reg_obj)
                 MVM_exception_throw_adhoc(tc, "MVMArray: unshift expected object register");
-            MVM_ASSIGN_REF(tc, root, body->slots.o[body->start], value.o);
+            MVM_ASSIGN_REF_CARD(tc, root, &body->cards, body->start,
+                body->slots.o[body->start], value.o);
             break;
         case MVM_ARRAY_STR:
             if (kind != MVM_reg_str)
                 MVM_exception_throw_adhoc(tc, "MVMArray: unshift expected string register");
-            MVM_ASSIGN_REF(tc, root, body->slots.s[body->start], value.s);
+            MVM_ASSIGN_REF_CARD(tc, root, &body->cards, body->start,
+                body->slots.s[body->start], value.s);
             break;
         case MVM_ARRAY_I64:
             if (kind != MVM_reg_int64)
@@ -669,10 +690,11 @@ static void splice(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *d
             (char *)body->slots.any + (start + offset + elems1) * repr_data->elem_size,
             (char *)body->slots.any + (start + offset + count) * repr_data->elem_size,
             tail * repr_data->elem_size);
+        MVM_gc_card_mark_all(tc, (MVMCollectable *)root);
     }
 
     /* now resize the array */
-    set_size_internal(tc, body, offset + elems1 + tail, repr_data);
+    set_size_internal(tc, root, body, offset + elems1 + tail, repr_data);
 
     start = body->start;
     if (tail > 0 && count < elems1) {
@@ -681,6 +703,7 @@ static void splice(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *d
             (char *)body->slots.any + (start + offset + elems1) * repr_data->elem_size,
             (char *)body->slots.any + (start + offset + count) * repr_data->elem_size,
             tail * repr_data->elem_size);
+        MVM_gc_card_mark_all(tc, (MVMCollectable *)root);
     }
 
     /* now copy C<from>'s elements into SELF */
@@ -807,10 +830,12 @@ MVMREPROps * MVMArray_initialize(MVMThreadContext *tc) {
     memset(this_repr, 0, sizeof(MVMREPROps));
     this_repr->type_object_for = type_object_for;
     this_repr->allocate = allocate;
+    this_repr->fixed_size = 1;
     this_repr->initialize = initialize;
     this_repr->copy_to = copy_to;
     this_repr->gc_mark = gc_mark;
     this_repr->gc_free = gc_free;
+    this_repr->gc_mark_cards = gc_mark_cards;
     this_repr->get_storage_spec = get_storage_spec;
     this_repr->pos_funcs = malloc(sizeof(MVMREPROps_Positional));
     this_repr->pos_funcs->at_pos = at_pos;
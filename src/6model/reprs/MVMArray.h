@@ -22,6 +22,10 @@ struct MVMArrayBody {
         MVMnum32   *n32;
         void       *any;
     } slots;
+
+    /* Card table over the slots, for arrays of objects or strings that are
+     * in generation 2; NULL until one is needed. */
+    MVMGCCardTable *cards;
 };
 struct MVMArray {
     MVMObject common;
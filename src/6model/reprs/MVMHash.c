@@ -28,58 +28,180 @@ static MVMObject * allocate(MVMThreadContext *tc, MVMSTable *st) {
 static void initialize(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data) {
     MVMHashBody *body = (MVMHashBody *)data;
 
-    /* this must be initialized to NULL */
-    body->hash_head = NULL;
+    /* these must be initialized to NULL */
+    body->pairs = NULL;
+    body->index = NULL;
 }
 
-static void extract_key(MVMThreadContext *tc, void **kdata, size_t *klen, MVMObject *key) {
-    MVM_HASH_EXTRACT_KEY(tc, kdata, klen, key, "MVMHash representation requires MVMString keys")
+/* Checks a key is a concrete MVMString, and gives its hash code. */
+static MVMuint32 key_hash_code(MVMThreadContext *tc, MVMObject *key) {
+    if (REPR(key)->ID != MVM_REPR_ID_MVMString || !IS_CONCRETE(key))
+        MVM_exception_throw_adhoc(tc, "MVMHash representation requires MVMString keys");
+    return MVM_string_hash_code(tc, (MVMString *)key);
+}
+
+/* Finds the pair with the given key, giving its number, or -1 if there is
+ * none. Keys are only compared if their hash codes are the same. */
+static MVMint64 find_pair(MVMThreadContext *tc, MVMHashBody *body, MVMObject *key, MVMuint32 hash_code) {
+    MVMuint32 slot, pair;
+    if (!body->index)
+        return -1;
+    slot = hash_code & body->index_mask;
+    while ((pair = body->index[slot])) {
+        MVMHashPair *p = &body->pairs[pair - 1];
+        if (p->hash_code == hash_code && p->key
+                && (p->key == key || MVM_string_equal(tc, (MVMString *)p->key, (MVMString *)key)))
+            return pair - 1;
+        slot = (slot + 1) & body->index_mask;
+    }
+    return -1;
+}
+
+/* The number of pairs an index can take, staying no more than 3/4 full. */
+#define INDEX_CAPACITY(body) ((body)->index ? ((body)->index_mask + 1) / 4 * 3 : 0)
+
+/* Rebuilds the index, dropping deleted pairs, with room for twice as many
+ * pairs as are left (so that many can be added or deleted before the next
+ * rebuild). Iterators see the count of compactions change if any pairs were
+ * dropped, even ones at the end that nothing had to move for, since new
+ * pairs go in their place. Returns non-zero if that moved any pairs. */
+static MVMuint32 rebuild(MVMThreadContext *tc, MVMHashBody *body) {
+    MVMuint32 num_slots = 8;
+    MVMuint32 i, kept = 0, moved = 0;
+
+    for (i = 0; i < body->num_pairs; i++) {
+        if (body->pairs[i].key) {
+            if (kept != i) {
+                body->pairs[kept] = body->pairs[i];
+                moved = 1;
+            }
+            kept++;
+        }
+    }
+    if (kept != body->num_pairs)
+        body->compactions++;
+    body->num_pairs = kept;
+
+    while (num_slots / 4 * 3 < kept * 2)
+        num_slots *= 2;
+    if (body->alloc_pairs < num_slots / 4 * 3) {
+        body->alloc_pairs = num_slots / 4 * 3;
+        body->pairs = realloc(body->pairs, body->alloc_pairs * sizeof(MVMHashPair));
+    }
+    free(body->index);
+    body->index      = calloc(num_slots, sizeof(MVMuint32));
+    body->index_mask = num_slots - 1;
+    for (i = 0; i < kept; i++) {
+        MVMuint32 slot = body->pairs[i].hash_code & body->index_mask;
+        while (body->index[slot])
+            slot = (slot + 1) & body->index_mask;
+        body->index[slot] = i + 1;
+    }
+    return moved;
+}
+
+/* Gives the number of the first pair from the given one on that was not
+ * deleted, or the number of pairs if there is none. */
+MVMuint32 MVM_hash_next_pair(MVMThreadContext *tc, MVMHashBody *body, MVMuint32 pair) {
+    while (pair < body->num_pairs && !body->pairs[pair].key)
+        pair++;
+    return pair;
+}
+
+/* Gives the number of the first pair whose sequence number is at least the
+ * given one, or the number of pairs if there is none. The pairs are in the
+ * order of their sequence numbers, deleted ones or not, so we can search
+ * them by halves. */
+MVMuint32 MVM_hash_pair_by_seq(MVMThreadContext *tc, MVMHashBody *body, MVMuint64 seq) {
+    MVMuint32 low = 0, high = body->num_pairs;
+    while (low < high) {
+        MVMuint32 mid = low + (high - low) / 2;
+        if (body->pairs[mid].seq < seq)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return low;
 }
 
 /* Copies the body of one object to another. */
 static void copy_to(MVMThreadContext *tc, MVMSTable *st, void *src, MVMObject *dest_root, void *dest) {
     MVMHashBody *src_body  = (MVMHashBody *)src;
     MVMHashBody *dest_body = (MVMHashBody *)dest;
-    MVMHashEntry *current, *tmp;
-
-    /* NOTE: if we really wanted to, we could avoid rehashing... */
-    HASH_ITER(hash_handle, src_body->hash_head, current, tmp) {
-        size_t klen;
-        void *kdata;
-        MVMHashEntry *new_entry = malloc(sizeof(MVMHashEntry));
-        new_entry->key = current->key;
-        new_entry->value = current->value;
-        extract_key(tc, &kdata, &klen, current->key);
-
-        HASH_ADD_KEYPTR(hash_handle, dest_body->hash_head, kdata, klen, new_entry);
+
+    /* The hash codes are kept with the pairs, so there's no rehashing. */
+    *dest_body = *src_body;
+    dest_body->cards = NULL;
+    if (src_body->pairs) {
+        dest_body->pairs = malloc(src_body->alloc_pairs * sizeof(MVMHashPair));
+        memcpy(dest_body->pairs, src_body->pairs, src_body->num_pairs * sizeof(MVMHashPair));
+        dest_body->index = malloc((src_body->index_mask + 1) * sizeof(MVMuint32));
+        memcpy(dest_body->index, src_body->index, (src_body->index_mask + 1) * sizeof(MVMuint32));
     }
 }
 
 /* Adds held objects to the GC worklist. */
 static void gc_mark(MVMThreadContext *tc, MVMSTable *st, void *data, MVMGCWorklist *worklist) {
     MVMHashBody *body = (MVMHashBody *)data;
-    MVMHashEntry *current, *tmp;
+    MVMuint32 i;
+
+    for (i = 0; i < body->num_pairs; i++) {
+        MVM_gc_worklist_add(tc, worklist, &body->pairs[i].key);
+        MVM_gc_worklist_add(tc, worklist, &body->pairs[i].value);
+    }
+}
+
+/* Tells whether a collectable is in the nursery. */
+#define IN_NURSERY(c) ((c) && !(((MVMCollectable *)(c))->flags & MVM_CF_SECOND_GEN))
 
-    HASH_ITER(hash_handle, body->hash_head, current, tmp) {
-        MVM_gc_worklist_add(tc, worklist, &current->key);
-        MVM_gc_worklist_add(tc, worklist, &current->value);
+/* Adds held objects in dirty cards to the GC worklist. The cards cover the
+ * pairs, in the order they were added. Each card we look at stays dirty
+ * only if it still holds a reference to a nursery object. */
+static MVMuint32 gc_mark_cards(MVMThreadContext *tc, MVMSTable *st, void *data, MVMGCWorklist *worklist, MVMuint32 all) {
+    MVMHashBody    *body = (MVMHashBody *)data;
+    MVMGCCardTable *table;
+    MVMuint64       card, num_cards;
+    MVMuint32       any_dirty = 0;
+
+    if (!body->num_pairs) {
+        MVM_gc_card_table_free(tc, &body->cards);
+        return 0;
+    }
+    num_cards = ((body->num_pairs - 1) >> MVM_GC_CARD_BITS) + 1;
+    table     = MVM_gc_card_table_ensure(tc, &body->cards, num_cards);
+    memset(table->dirty + num_cards, 0, table->num_cards - num_cards);
+
+    for (card = 0; card < num_cards; card++) {
+        MVMuint64 i, limit;
+        MVMuint8  dirty = 0;
+        if (!all && !table->dirty[card])
+            continue;
+        i     = card << MVM_GC_CARD_BITS;
+        limit = i + MVM_GC_CARD_SIZE;
+        if (limit > body->num_pairs)
+            limit = body->num_pairs;
+        for (; i < limit; i++) {
+            MVMHashPair *p = &body->pairs[i];
+            if (IN_NURSERY(p->key) || IN_NURSERY(p->value)) {
+                MVM_gc_worklist_add(tc, worklist, &p->key);
+                MVM_gc_worklist_add(tc, worklist, &p->value);
+                dirty = 1;
+            }
+        }
+        table->dirty[card] = dirty;
+        any_dirty |= dirty;
     }
+    return any_dirty;
 }
 
 /* Called by the VM in order to free memory associated with this object. */
 static void gc_free(MVMThreadContext *tc, MVMObject *obj) {
     MVMHash *h = (MVMHash *)obj;
-    MVMHashEntry *current, *tmp;
-
-    /* The macros already check for null. Also, must not delete the head
-     * node until after calling clear, or we look into freed memory. */
-    HASH_ITER(hash_handle, h->body.hash_head, current, tmp) {
-        if (current != h->body.hash_head)
-            free(current);
-    }
-    HASH_CLEAR(hash_handle, h->body.hash_head);
-    if (h->body.hash_head)
-        free(h->body.hash_head);
+    free(h->body.pairs);
+    free(h->body.index);
+    h->body.pairs = NULL;
+    h->body.index = NULL;
+    MVM_gc_card_table_free(tc, &h->body.cards);
 }
 
 static void * at_key_ref(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data, MVMObject *key) {
@@ -89,12 +211,8 @@ static void * at_key_ref(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, v
 
 static MVMObject * at_key_boxed(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data, MVMObject *key) {
     MVMHashBody *body = (MVMHashBody *)data;
-    void *kdata;
-    MVMHashEntry *entry;
-    size_t klen;
-    extract_key(tc, &kdata, &klen, key);
-    HASH_FIND(hash_handle, body->hash_head, kdata, klen, entry);
-    return entry != NULL ? entry->value : NULL;
+    MVMint64 pair = find_pair(tc, body, key, key_hash_code(tc, key));
+    return pair >= 0 ? body->pairs[pair].value : NULL;
 }
 
 static void bind_key_ref(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data, MVMObject *key, void *value_addr) {
@@ -104,53 +222,50 @@ static void bind_key_ref(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, v
 
 static void bind_key_boxed(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data, MVMObject *key, MVMObject *value) {
     MVMHashBody *body = (MVMHashBody *)data;
-    void *kdata;
-    MVMHashEntry *entry;
-    size_t klen;
+    MVMuint32 hash_code = key_hash_code(tc, key);
+    MVMint64 pair = find_pair(tc, body, key, hash_code);
+
+    if (pair < 0) {
+        MVMuint32 slot;
 
-    extract_key(tc, &kdata, &klen, key);
+        /* Make room if we're out of it; if deleted pairs got dropped,
+         * the others moved to other cards. */
+        if (body->num_pairs == INDEX_CAPACITY(body))
+            if (rebuild(tc, body))
+                MVM_gc_card_mark_all(tc, (MVMCollectable *)root);
 
-    /* first check whether we can must update the old entry. */
-    HASH_FIND(hash_handle, body->hash_head, kdata, klen, entry);
-    if (!entry) {
-        entry = malloc(sizeof(MVMHashEntry));
-        HASH_ADD_KEYPTR(hash_handle, body->hash_head, kdata, klen, entry);
+        pair = body->num_pairs++;
+        body->num_items++;
+        body->pairs[pair].key       = NULL;
+        body->pairs[pair].value     = NULL;
+        body->pairs[pair].seq       = body->next_seq++;
+        body->pairs[pair].hash_code = hash_code;
+        slot = hash_code & body->index_mask;
+        while (body->index[slot])
+            slot = (slot + 1) & body->index_mask;
+        body->index[slot] = (MVMuint32)pair + 1;
     }
-    else
-        entry->hash_handle.key = (void *)kdata;
-    entry->key = key;
-    entry->value = value;
-    MVM_WB(tc, root, key);
-    MVM_WB(tc, root, value);
+    MVM_ASSIGN_REF_CARD(tc, root, &body->cards, pair, body->pairs[pair].key, key);
+    MVM_ASSIGN_REF_CARD(tc, root, &body->cards, pair, body->pairs[pair].value, value);
 }
 
 static MVMuint64 elems(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data) {
     MVMHashBody *body = (MVMHashBody *)data;
-    return HASH_CNT(hash_handle, body->hash_head);
+    return body->num_items;
 }
 
 static MVMuint64 exists_key(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data, MVMObject *key) {
     MVMHashBody *body = (MVMHashBody *)data;
-    void *kdata;
-    MVMHashEntry *entry;
-    size_t klen;
-    extract_key(tc, &kdata, &klen, key);
-
-    HASH_FIND(hash_handle, body->hash_head, kdata, klen, entry);
-    return entry != NULL;
+    return find_pair(tc, body, key, key_hash_code(tc, key)) >= 0;
 }
 
 static void delete_key(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data, MVMObject *key) {
     MVMHashBody *body = (MVMHashBody *)data;
-    MVMHashEntry *old_entry;
-    size_t klen;
-    void *kdata;
-    extract_key(tc, &kdata, &klen, key);
-
-    HASH_FIND(hash_handle, body->hash_head, kdata, klen, old_entry);
-    if (old_entry) {
-        HASH_DELETE(hash_handle, body->hash_head, old_entry);
-        free(old_entry);
+    MVMint64 pair = find_pair(tc, body, key, key_hash_code(tc, key));
+    if (pair >= 0) {
+        body->pairs[pair].key   = NULL;
+        body->pairs[pair].value = NULL;
+        body->num_items--;
     }
 }
 
@@ -192,6 +307,7 @@ MVMREPROps * MVMHash_initialize(MVMThreadContext *tc) {
     this_repr->copy_to = copy_to;
     this_repr->gc_mark = gc_mark;
     this_repr->gc_free = gc_free;
+    this_repr->gc_mark_cards = gc_mark_cards;
     this_repr->get_storage_spec = get_storage_spec;
     this_repr->ass_funcs = malloc(sizeof(MVMREPROps_Associative));
     this_repr->ass_funcs->at_key_ref = at_key_ref;
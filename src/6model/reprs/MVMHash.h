@@ -1,5 +1,7 @@
 /* Representation used by VM-level hashes. */
 
+/* An entry in a uthash hash keyed by MVMStrings, as used by HashAttrStore and
+ * by the VM's own lookup tables (through the MVM_HASH_* macros below). */
 struct MVMHashEntry {
     /* key object (must be MVMString REPR) */
     MVMObject *key;
@@ -11,11 +13,42 @@ struct MVMHashEntry {
     UT_hash_handle hash_handle;
 };
 
+/* A key and value in an MVMHash, with the key's hash code. A deleted pair
+ * has a NULL key. Pairs are numbered in the order they were added, so that
+ * iterators can find their place again after the pairs moved. */
+struct MVMHashPair {
+    MVMObject *key;
+    MVMObject *value;
+    MVMuint64  seq;
+    MVMuint32  hash_code;
+};
+
+/* An MVMHash keeps its pairs in an array, in the order they were added, and
+ * finds them with an index using open addressing with linear probing. Each
+ * slot of the index is 0 if empty, or else 1 more than the number of a pair.
+ * Deleting a pair leaves it in the array, with a NULL key, so its slot goes
+ * on taking part in probing; such pairs are dropped when the index is next
+ * rebuilt. */
 struct MVMHashBody {
+    /* The pairs, how many there are (deleted ones included) and how many
+     * there is room for, and how many are not deleted. */
+    MVMHashPair *pairs;
+    MVMuint32    num_pairs;
+    MVMuint32    alloc_pairs;
+    MVMuint32    num_items;
+
+    /* The index, and its number of slots less one (a power of 2 less 1). */
+    MVMuint32   *index;
+    MVMuint32    index_mask;
 
-    /* uthash updates this pointer directly. */
-    MVMHashEntry *hash_head;
+    /* The number the next pair added gets, and how many times rebuilding
+     * the index dropped deleted pairs, moving the others. */
+    MVMuint64    next_seq;
+    MVMuint32    compactions;
 
+    /* Card table over the pairs, for when the hash is in generation 2;
+     * NULL until one is needed. */
+    MVMGCCardTable *cards;
 };
 struct MVMHash {
     MVMObject common;
@@ -24,6 +57,8 @@ struct MVMHash {
 
 /* Function for REPR setup. */
 MVMREPROps * MVMHash_initialize(MVMThreadContext *tc);
+MVMuint32 MVM_hash_next_pair(MVMThreadContext *tc, MVMHashBody *body, MVMuint32 pair);
+MVMuint32 MVM_hash_pair_by_seq(MVMThreadContext *tc, MVMHashBody *body, MVMuint64 seq);
 
 #define MVM_HASH_ACTION(tc, hash, name, entry, action, member, size) \
     action(hash_handle, hash, \
@@ -90,6 +90,24 @@ static void unshift(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *
     MVM_exception_throw_adhoc(tc, "Invalid operation on iterator");
 }
 
+/* Brings the place of a hash iterator up to date, should the hash have
+ * dropped deleted pairs since the iterator last looked. Then gives the
+ * number of the next pair that is not deleted, or the number of pairs if
+ * there is none. */
+static MVMuint32 next_hash_pair(MVMThreadContext *tc, MVMIterBody *body) {
+    MVMHashBody *hash = &((MVMHash *)body->target)->body;
+    if (body->hash_state.compactions != hash->compactions) {
+        body->hash_state.next = MVM_hash_pair_by_seq(tc, hash, body->hash_state.next_seq);
+        if (body->hash_state.curr) {
+            MVMuint32 curr = MVM_hash_pair_by_seq(tc, hash, body->hash_state.curr_seq);
+            body->hash_state.curr = curr < hash->num_pairs
+                && hash->pairs[curr].seq == body->hash_state.curr_seq ? curr + 1 : 0;
+        }
+        body->hash_state.compactions = hash->compactions;
+    }
+    return MVM_hash_next_pair(tc, hash, body->hash_state.next);
+}
+
 static void shift(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *data, MVMRegister *value, MVMuint16 kind) {
     MVMIterBody *body = (MVMIterBody *)data;
     MVMObject *target = body->target;
@@ -100,22 +118,18 @@ static void shift(MVMThreadContext *tc, MVMSTable *st, MVMObject *root, void *da
                 MVM_exception_throw_adhoc(tc, "Iteration past end of iterator");
             REPR(target)->pos_funcs->at_pos(tc, STABLE(target), target, OBJECT_BODY(target), body->array_state.index, value, kind);
             return;
-        case MVM_ITER_MODE_HASH:
-            if (!body->hash_state.curr) {
-                if (body->hash_state.next) {
-                    body->hash_state.curr = body->hash_state.next;
-                    body->hash_state.next = body->hash_state.next->hash_handle.next;
-                }
-                else {
-                    MVM_exception_throw_adhoc(tc, "Iteration past end of iterator");
-                }
-            }
-            else {
-                body->hash_state.curr = body->hash_state.curr->hash_handle.next;
-                body->hash_state.next = body->hash_state.curr->hash_handle.next;
-            }
+        case MVM_ITER_MODE_HASH: {
+            MVMHashBody *hash = &((MVMHash *)body->target)->body;
+            MVMuint32 next = next_hash_pair(tc, body);
+            if (next >= hash->num_pairs)
+                MVM_exception_throw_adhoc(tc, "Iteration past end of iterator");
+            body->hash_state.curr     = next + 1;
+            body->hash_state.next     = next + 1;
+            body->hash_state.curr_seq = hash->pairs[next].seq;
+            body->hash_state.next_seq = hash->pairs[next].seq + 1;
             value->o = root;
             return;
+        }
         default:
             MVM_exception_throw_adhoc(tc, "Unknown iteration mode");
     }
@@ -185,7 +199,11 @@ MVMObject * MVM_iter(MVMThreadContext *tc, MVMObject *target) {
         }
         else if (REPR(target)->ID == MVM_REPR_ID_MVMHash) {
             iterator->body.mode = MVM_ITER_MODE_HASH;
-            iterator->body.hash_state.next = ((MVMHash *)target)->body.hash_head;
+            iterator->body.hash_state.next        = 0;
+            iterator->body.hash_state.curr        = 0;
+            iterator->body.hash_state.next_seq    = 0;
+            iterator->body.hash_state.curr_seq    = 0;
+            iterator->body.hash_state.compactions = ((MVMHash *)target)->body.compactions;
         }
         else {
             MVM_exception_throw_adhoc(tc, "Cannot iterate this");
@@ -199,21 +217,31 @@ MVMint64 MVM_iter_istrue(MVMThreadContext *tc, MVMIter *iter) {
         case MVM_ITER_MODE_ARRAY:
             return iter->body.array_state.index + 1 < iter->body.array_state.limit ? 1 : 0;
             break;
-        case MVM_ITER_MODE_HASH:
-            return iter->body.hash_state.next != NULL ? 1 : 0;
-            break;
+        case MVM_ITER_MODE_HASH: {
+            MVMHashBody *hash = &((MVMHash *)iter->body.target)->body;
+            return next_hash_pair(tc, &iter->body) < hash->num_pairs ? 1 : 0;
+        }
         default:
             MVM_exception_throw_adhoc(tc, "Invalid iteration mode used");
     }
 }
 
+/* Gives the pair a hash iterator is at. */
+static MVMHashPair * current_pair(MVMThreadContext *tc, MVMIter *iterator) {
+    MVMHashBody *hash = &((MVMHash *)iterator->body.target)->body;
+    MVMuint32 curr;
+    next_hash_pair(tc, &iterator->body);
+    curr = iterator->body.hash_state.curr;
+    if (!curr || curr > hash->num_pairs || !hash->pairs[curr - 1].key)
+        MVM_exception_throw_adhoc(tc, "You have not advanced to the first item of the hash iterator, or have gone past the end");
+    return &hash->pairs[curr - 1];
+}
+
 MVMString * MVM_iterkey_s(MVMThreadContext *tc, MVMIter *iterator) {
     if (REPR(iterator)->ID != MVM_REPR_ID_MVMIter
             || iterator->body.mode != MVM_ITER_MODE_HASH)
         MVM_exception_throw_adhoc(tc, "This is not a hash iterator");
-    if (!iterator->body.hash_state.curr)
-        MVM_exception_throw_adhoc(tc, "You have not advanced to the first item of the hash iterator, or have gone past the end");
-    return (MVMString *)iterator->body.hash_state.curr->key;
+    return (MVMString *)current_pair(tc, iterator)->key;
 }
 
 MVMObject * MVM_iterval(MVMThreadContext *tc, MVMIter *iterator) {
@@ -230,9 +258,7 @@ MVMObject * MVM_iterval(MVMThreadContext *tc, MVMIter *iterator) {
         REPR(target)->pos_funcs->at_pos(tc, STABLE(target), target, OBJECT_BODY(target), body->array_state.index, &result, MVM_reg_obj);
     }
     else if (iterator->body.mode == MVM_ITER_MODE_HASH) {
-        if (!iterator->body.hash_state.curr)
-        MVM_exception_throw_adhoc(tc, "You have not advanced to the first item of the hash iterator, or have gone past the end");
-        result.o = iterator->body.hash_state.curr->value;
+        result.o = current_pair(tc, iterator)->value;
     }
     else {
         MVM_exception_throw_adhoc(tc, "Unknown iterator mode in iterval");
@@ -13,8 +13,18 @@ struct MVMIterBody {
     /* next hash item to give or next array index */
     union {
         struct {
-            MVMHashEntry *next;
-            MVMHashEntry *curr;
+            /* the number of the next pair, and 1 more than that of the
+             * current pair (0 before the first) */
+            MVMuint32 next;
+            MVMuint32 curr;
+
+            /* the hash's count of compactions when those were worked
+             * out; if it changed, the pairs moved, so we find them again
+             * by their sequence numbers, which are the least one the next
+             * pair may have, and that of the current pair */
+            MVMuint32 compactions;
+            MVMuint64 next_seq;
+            MVMuint64 curr_seq;
         } hash_state;
         struct {
             MVMint64 index;
@@ -40,6 +40,9 @@ static void copy_to(MVMThreadContext *tc, MVMSTable *st, void *src, MVMObject *d
     MVMStaticFrameBody *dest_body = (MVMStaticFrameBody *)dest;
     
     dest_body->bytecode = src_body->bytecode;
+    dest_body->decoded_bytecode = NULL;
+    dest_body->lexical_caches = NULL;
+    dest_body->num_lexical_caches = 0;
     MVM_ASSIGN_REF(tc, dest_root, dest_body->cu, src_body->cu);
     MVM_ASSIGN_REF(tc, dest_root, dest_body->cuuid, src_body->cuuid);
     MVM_ASSIGN_REF(tc, dest_root, dest_body->name, src_body->name);
@@ -105,6 +108,19 @@ static void gc_mark(MVMThreadContext *tc, MVMSTable *st, void *data, MVMGCWorkli
         MVM_gc_worklist_add(tc, worklist, &current->key);
     }
 
+    /* static frames and names held by lexical lookup caches */
+    if (body->lexical_caches) {
+        MVMuint32 i, j;
+        for (i = 0; i < body->num_lexical_caches; i++) {
+            MVMLexicalCache *cache = &body->lexical_caches[i];
+            if (cache->name) {
+                MVM_gc_worklist_add(tc, worklist, &cache->name);
+                for (j = 0; j <= cache->hops; j++)
+                    MVM_gc_worklist_add(tc, worklist, &cache->path[j]);
+            }
+        }
+    }
+
     /* prior invocation */
     MVM_gc_worklist_add_frame(tc, worklist, body->prior_invocation);
 
@@ -123,6 +139,15 @@ static void gc_mark(MVMThreadContext *tc, MVMSTable *st, void *data, MVMGCWorkli
 static void gc_free(MVMThreadContext *tc, MVMObject *obj) {
     MVMStaticFrame *sf = (MVMStaticFrame *)obj;
     MVMStaticFrameBody *body = &sf->body;
+    free(body->decoded_bytecode);
+    body->decoded_bytecode = NULL;
+    if (body->lexical_caches) {
+        MVMuint32 i;
+        for (i = 0; i < body->num_lexical_caches; i++)
+            free(body->lexical_caches[i].path);
+        free(body->lexical_caches);
+        body->lexical_caches = NULL;
+    }
     free(body->handlers);
     body->handlers = NULL;
     free(body->static_env);
@@ -3,6 +3,10 @@ struct MVMStaticFrameBody {
     /* The start of the stream of bytecode for this routine. */
     MVMuint8 *bytecode;
 
+    /* The bytecode in the form the interpreter runs it; produced from the
+     * above when the frame is first invoked. */
+    MVMuint8 *decoded_bytecode;
+
     /* The compilation unit this frame belongs to. */
     MVMCompUnit *cu;
 
@@ -15,6 +19,11 @@ struct MVMStaticFrameBody {
     /* Lexicals name map. */
     MVMLexicalHashEntry *lexical_names;
 
+    /* Caches for the ops that look up lexicals by name, ordered by their
+     * offset in the bytecode; set up when the bytecode is pre-decoded. */
+    MVMLexicalCache *lexical_caches;
+    MVMuint32 num_lexical_caches;
+
     /* The environment for this frame, which lives beyond its execution. */
 
     /* Defaults for lexicals upon new frame creation. */
@@ -33,6 +33,7 @@ static void copy_to(MVMThreadContext *tc, MVMSTable *st, void *src, MVMObject *d
     MVMStringBody *src_body  = (MVMStringBody *)src;
     MVMStringBody *dest_body = (MVMStringBody *)dest;
     dest_body->codes  = src_body->codes;
+    dest_body->hash_code = src_body->hash_code;
     dest_body->flags  = src_body->flags;
     switch(src_body->flags & MVM_STRING_TYPE_MASK) {
         case MVM_STRING_TYPE_INT32:
@@ -79,6 +79,10 @@ struct MVMStringBody {
      */
     MVMStringIndex codes;
 
+    /* A hash code of the codepoints, the same whatever form the string is
+        in; 0 until computed, by MVM_string_hash_code. */
+    MVMuint32 hash_code;
+
     /* Lowest 2 bits: type of string: int32, uint8, or Rope. */
     MVMuint8 flags;
 };
@@ -86,6 +86,7 @@ MVMREPROps * MVMP6num_initialize(MVMThreadContext *tc) {
     memset(this_repr, 0, sizeof(MVMREPROps));
     this_repr->type_object_for = type_object_for;
     this_repr->allocate = allocate;
+    this_repr->fixed_size = 1;
     this_repr->copy_to = copy_to;
     this_repr->get_storage_spec = get_storage_spec;
     this_repr->box_funcs = malloc(sizeof(MVMREPROps_Boxing));
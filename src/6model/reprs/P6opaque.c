@@ -1137,6 +1137,7 @@ MVMREPROps * MVMP6opaque_initialize(MVMThreadContext *tc) {
     memset(this_repr, 0, sizeof(MVMREPROps));
     this_repr->type_object_for = type_object_for;
     this_repr->allocate = allocate;
+    this_repr->fixed_size = 1;
     this_repr->initialize = initialize;
     this_repr->copy_to = copy_to;
     this_repr->gc_mark = gc_mark;
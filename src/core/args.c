@@ -1,25 +1,87 @@
 #include "moarvm.h"
 
+/* Marks all nameds as unused. Up to 64 of them fit in the bitmap inside
+ * the context; if there are more, a big enough bitmap is allocated. */
 static void init_named_used(MVMThreadContext *tc, MVMArgProcContext *ctx, MVMuint16 num) {
-    if (ctx->named_used && ctx->named_used_size >= num) { /* reuse the old one */
-        memset(ctx->named_used, 0, ctx->named_used_size * sizeof(MVMuint8));
-    }
-    else {
-        if (ctx->named_used) {
-            free(ctx->named_used);
-            ctx->named_used = NULL;
+    MVMuint32 words = (num + 63) / 64;
+    ctx->named_used_bits = 0;
+    ctx->named_lookups   = 0;
+    if (num > 64) {
+        if (ctx->named_used && (ctx->named_used_size + 63) / 64 >= words) { /* reuse the old one */
+            memset(ctx->named_used, 0, words * sizeof(MVMuint64));
+            return;
         }
+        if (ctx->named_used)
+            free(ctx->named_used);
+        ctx->named_used = calloc(words, sizeof(MVMuint64));
         ctx->named_used_size = num;
-        ctx->named_used = ctx->named_used_size ? calloc(sizeof(MVMuint8), ctx->named_used_size) : NULL;
+    }
+    else if (ctx->named_used) {
+        free(ctx->named_used);
+        ctx->named_used = NULL;
+        ctx->named_used_size = 0;
     }
 }
 
+/* Checks or sets whether the named at the given index among the nameds was
+ * used already. */
+#define NAMED_USED_WORD(ctx, idx) \
+    (*((ctx)->named_used ? &(ctx)->named_used[(idx) / 64] : &(ctx)->named_used_bits))
+#define NAMED_USED_BIT(idx) ((MVMuint64)1 << ((idx) % 64))
+#define NAMED_IS_USED(ctx, idx) (NAMED_USED_WORD(ctx, idx) & NAMED_USED_BIT(idx))
+#define NAMED_SET_USED(ctx, idx) (NAMED_USED_WORD(ctx, idx) |= NAMED_USED_BIT(idx))
+
+/* Checks whether two callsites have the same shape. */
+static MVMint32 callsites_equal(MVMCallsite *a, MVMCallsite *b) {
+    return a->arg_count == b->arg_count && a->num_pos == b->num_pos
+        && a->flag_count == b->flag_count
+        && (!a->flag_count || memcmp(a->arg_flags, b->arg_flags, a->flag_count) == 0);
+}
+
+/* Looks for an interned callsite of the same shape as the one passed. If
+ * there is one, the callsite is freed and the pointer updated to point at
+ * the interned one; otherwise the callsite is interned, unless it has too
+ * many flags. Only callsites that were malloced, along with their flags,
+ * should be passed. */
+void MVM_callsite_try_intern(MVMThreadContext *tc, MVMCallsite **cs_ptr) {
+    MVMCallsiteInterns *interns = tc->instance->callsite_interns;
+    MVMCallsite *cs = *cs_ptr;
+    MVMuint16 arity = cs->flag_count;
+    MVMuint32 i, num;
+
+    if (arity >= MVM_INTERN_ARITY_LIMIT)
+        return;
+
+    if (apr_thread_mutex_lock(tc->instance->mutex_callsite_interns) != APR_SUCCESS)
+        MVM_panic(MVM_exitcode_threads, "Unable to lock callsite interns");
+    num = interns->num_by_arity[arity];
+    for (i = 0; i < num; i++) {
+        if (callsites_equal(interns->by_arity[arity][i], cs)) {
+            free(cs->arg_flags);
+            free(cs);
+            *cs_ptr = interns->by_arity[arity][i];
+            break;
+        }
+    }
+    if (i == num) {
+        if (num % 8 == 0)
+            interns->by_arity[arity] = realloc(interns->by_arity[arity],
+                (num + 8) * sizeof(MVMCallsite *));
+        interns->by_arity[arity][num] = cs;
+        interns->num_by_arity[arity]++;
+    }
+    if (apr_thread_mutex_unlock(tc->instance->mutex_callsite_interns) != APR_SUCCESS)
+        MVM_panic(MVM_exitcode_threads, "Unable to unlock callsite interns");
+}
+
 /* Initialize arguments processing context. */
 void MVM_args_proc_init(MVMThreadContext *tc, MVMArgProcContext *ctx, MVMCallsite *callsite, MVMRegister *args) {
     /* Stash callsite and argument counts/pointers. */
     ctx->callsite = callsite;
-    /* initial counts and values; can be altered by flatteners */
-    init_named_used(tc, ctx, (callsite->arg_count - callsite->num_pos) / 2);
+    /* initial counts and values; can be altered by flatteners. Nothing
+     * looks at which nameds were used if there are none. */
+    if (callsite->num_named)
+        init_named_used(tc, ctx, callsite->num_named);
     ctx->args     = args;
     ctx->num_pos  = callsite->num_pos;
     ctx->arg_count = callsite->arg_count;
@@ -57,7 +119,8 @@ static void flatten_args(MVMThreadContext *tc, MVMArgProcContext *ctx);
 void MVM_args_checkarity(MVMThreadContext *tc, MVMArgProcContext *ctx, MVMuint16 min, MVMuint16 max) {
     MVMuint16 num_pos;
 
-    flatten_args(tc, ctx);
+    if (ctx->callsite->has_flattening)
+        flatten_args(tc, ctx);
 
     num_pos = ctx->num_pos;
     if (num_pos < min)
@@ -226,22 +289,59 @@ MVMArgInfo MVM_args_get_pos_str(MVMThreadContext *tc, MVMArgProcContext *ctx, MV
     return result;
 }
 
+/* Checks whether the named at the given index among the nameds has the
+ * given name. */
+#define named_has_name(tc, ctx, idx, name) \
+    (ctx->args[ctx->num_pos + 2 * (idx)].s == (name) || \
+        MVM_string_equal(tc, ctx->args[ctx->num_pos + 2 * (idx)].s, (name)))
+
+/* Gets this thread's named lookup hints for a callsite. Should the entry
+ * be held by another callsite, it is taken over with all hints at zero. */
+static MVMuint16 * named_hints(MVMThreadContext *tc, MVMCallsite *callsite) {
+    MVMNamedHints *entry = &tc->named_hints[((uintptr_t)callsite >> 4) & (MVM_NAMED_HINT_SETS - 1)];
+    if (entry->callsite != callsite) {
+        entry->callsite = callsite;
+        memset(entry->hints, 0, sizeof(entry->hints));
+    }
+    return entry->hints;
+}
+
+/* Finds the index among the nameds of the named with the given name, or
+ * returns -1 if there is none. We first try where the hint for the callsite
+ * says the same lookup found its name the last time. After a flattening,
+ * the nameds are not those of the callsite, so the hints don't apply. */
+static MVMint32 find_named(MVMThreadContext *tc, MVMArgProcContext *ctx, MVMString *name) {
+    MVMuint16 num_named = (ctx->arg_count - ctx->num_pos) / 2;
+    MVMuint16 lookup    = ctx->named_lookups++;
+    MVMuint16 *hint     = !ctx->arg_flags && lookup < MVM_NAMED_HINTS
+        ? &named_hints(tc, ctx->callsite)[lookup]
+        : NULL;
+    MVMuint16 i;
+    if (hint && *hint < num_named && named_has_name(tc, ctx, *hint, name))
+        return *hint;
+    for (i = 0; i < num_named; i++) {
+        if (named_has_name(tc, ctx, i, name)) {
+            if (hint)
+                *hint = i;
+            return i;
+        }
+    }
+    return -1;
+}
+
 #define args_get_named(tc, ctx, name, required, _type) do { \
      \
-    MVMuint32 flag_pos, arg_pos; \
+    MVMint32 named_idx = find_named(tc, ctx, name); \
     result.exists = 0; \
      \
-    for (flag_pos = arg_pos = ctx->num_pos; arg_pos < ctx->arg_count; flag_pos++, arg_pos += 2) { \
-        if (MVM_string_equal(tc, ctx->args[arg_pos].s, name)) { \
-            if (ctx->named_used[(arg_pos - ctx->num_pos)/2]) { \
-                MVM_exception_throw_adhoc(tc, "Named argument already used: %s", MVM_string_utf8_encode_C_string(tc, name)); \
-            } \
-            result.arg    = ctx->args[arg_pos + 1]; \
-            result.flags  = (ctx->arg_flags ? ctx->arg_flags : ctx->callsite->arg_flags)[flag_pos]; \
-            result.exists = 1; \
-            ctx->named_used[(arg_pos - ctx->num_pos)/2] = 1; \
-            break; \
+    if (named_idx >= 0) { \
+        if (NAMED_IS_USED(ctx, named_idx)) { \
+            MVM_exception_throw_adhoc(tc, "Named argument already used: %s", MVM_string_utf8_encode_C_string(tc, name)); \
         } \
+        result.arg    = ctx->args[ctx->num_pos + 2 * named_idx + 1]; \
+        result.flags  = (ctx->arg_flags ? ctx->arg_flags : ctx->callsite->arg_flags)[ctx->num_pos + named_idx]; \
+        result.exists = 1; \
+        NAMED_SET_USED(ctx, named_idx); \
     } \
     if (!result.exists && required) \
         MVM_exception_throw_adhoc(tc, "Required named " _type " argument missing: %s", MVM_string_utf8_encode_C_string(tc, name)); \
@@ -275,8 +375,18 @@ MVMArgInfo MVM_args_get_named_str(MVMThreadContext *tc, MVMArgProcContext *ctx,
 
 /* Result setting. The frameless flag indicates that the currently
  * executing code does not have a MVMFrame of its own. */
+
+/* Finds the frame that a result should be stored into, if any. The caller
+ * of a thread's entry frame is in the thread that started it, which will
+ * have moved on and reused the registers the result would go into. */
+static MVMFrame * result_target(MVMThreadContext *tc, MVMint32 frameless) {
+    if (frameless)
+        return tc->cur_frame;
+    return tc->cur_frame == tc->thread_entry_frame ? NULL : tc->cur_frame->caller;
+}
+
 void MVM_args_set_result_obj(MVMThreadContext *tc, MVMObject *result, MVMint32 frameless) {
-    MVMFrame *target = frameless ? tc->cur_frame : tc->cur_frame->caller;
+    MVMFrame *target = result_target(tc, frameless);
     if (target) {
         switch (target->return_type) {
             case MVM_RETURN_VOID:
@@ -300,7 +410,7 @@ void MVM_args_set_result_obj(MVMThreadContext *tc, MVMObject *result, MVMint32 f
 }
 
 void MVM_args_set_result_int(MVMThreadContext *tc, MVMint64 result, MVMint32 frameless) {
-    MVMFrame *target = frameless ? tc->cur_frame : tc->cur_frame->caller;
+    MVMFrame *target = result_target(tc, frameless);
     if (target) {
         switch (target->return_type) {
             case MVM_RETURN_VOID:
@@ -321,7 +431,7 @@ void MVM_args_set_result_int(MVMThreadContext *tc, MVMint64 result, MVMint32 fra
     }
 }
 void MVM_args_set_result_num(MVMThreadContext *tc, MVMnum64 result, MVMint32 frameless) {
-    MVMFrame *target = frameless ? tc->cur_frame : tc->cur_frame->caller;
+    MVMFrame *target = result_target(tc, frameless);
     if (target) {
         switch (target->return_type) {
             case MVM_RETURN_VOID:
@@ -342,7 +452,7 @@ void MVM_args_set_result_num(MVMThreadContext *tc, MVMnum64 result, MVMint32 fra
     }
 }
 void MVM_args_set_result_str(MVMThreadContext *tc, MVMString *result, MVMint32 frameless) {
-    MVMFrame *target = frameless ? tc->cur_frame : tc->cur_frame->caller;
+    MVMFrame *target = result_target(tc, frameless);
     if (target) {
         switch (target->return_type) {
             case MVM_RETURN_VOID:
@@ -454,7 +564,7 @@ MVMObject * MVM_args_slurpy_named(MVMThreadContext *tc, MVMArgProcContext *ctx)
     for (flag_pos = arg_pos = ctx->num_pos; arg_pos < ctx->arg_count; flag_pos++, arg_pos += 2) {
         MVMString *key;
 
-        if (ctx->named_used[flag_pos - ctx->num_pos]) continue;
+        if (NAMED_IS_USED(ctx, flag_pos - ctx->num_pos)) continue;
 
         key = ctx->args[arg_pos].s;
 
@@ -581,9 +691,12 @@ static void flatten_args(MVMThreadContext *tc, MVMArgProcContext *ctx) {
 
         if (arg_info.arg.o && REPR(arg_info.arg.o)->ID == MVM_REPR_ID_MVMHash) {
             MVMHashBody *body = &((MVMHash *)arg_info.arg.o)->body;
-            MVMHashEntry *current, *tmp;
+            MVMuint32 pair;
 
-            HASH_ITER(hash_handle, body->hash_head, current, tmp) {
+            for (pair = 0; pair < body->num_pairs; pair++) {
+                MVMHashPair *current = &body->pairs[pair];
+                if (!current->key)
+                    continue;
 
                 if (new_arg_pos + 1 >= new_args_size) {
                     new_args = realloc(new_args, (new_args_size *= 2) * sizeof(MVMRegister));
@@ -28,6 +28,9 @@ typedef enum {
 /* A callsite entry is just one of the above flags. */
 typedef MVMuint8 MVMCallsiteEntry;
 
+/* The number of named argument lookups per call we keep hints for. */
+#define MVM_NAMED_HINTS 8
+
 /* A callsite is an argument count and a bunch of flags. Note that it
  * does not contain the values; this is the *statically known* things
  * about the callsite and is immutable. It describes how to process
@@ -45,6 +48,34 @@ struct MVMCallsite {
 
     /* whether it has a flattening arg. */
     MVMuint8 has_flattening;
+
+    /* The number of flags, and of named args (each of which has one flag
+     * and two entries in the argument list). */
+    MVMuint16 flag_count;
+    MVMuint16 num_named;
+};
+
+/* The number of callsites each thread keeps named lookup hints for. */
+#define MVM_NAMED_HINT_SETS 256
+
+/* For the first few nameds looked up in a call from a callsite, the index
+ * among the nameds where each was found the last time. The code called from
+ * a callsite tends to look up the same names in the same order, so these
+ * usually save searching; they are checked before being used. Callsites are
+ * shared between threads, so each thread keeps its own hints, in a table
+ * indexed by callsite address. */
+struct MVMNamedHints {
+    MVMCallsite *callsite;
+    MVMuint16    hints[MVM_NAMED_HINTS];
+};
+
+/* Callsites with up to this many flags get interned. */
+#define MVM_INTERN_ARITY_LIMIT 8
+
+/* The interned callsites of an instance, by their number of flags. */
+struct MVMCallsiteInterns {
+    MVMCallsite **by_arity[MVM_INTERN_ARITY_LIMIT];
+    MVMuint32     num_by_arity[MVM_INTERN_ARITY_LIMIT];
 };
 
 /* Argument processing context. */
@@ -60,11 +91,15 @@ struct MVMArgProcContext {
     /* The arguments. */
     MVMRegister *args;
 
-    /* Bytemap of indexes of used nameds, so the
-     * named slurpy knows which ones not to grab.
-     * XXX cache and free this at the proper times. */
-    MVMuint8 *named_used;
-    MVMuint16 named_used_size;
+    /* Bitmap of indexes of used nameds, so the named slurpy knows which
+     * ones not to grab. It is kept in named_used_bits if there are up to 64
+     * nameds; otherwise, named_used points to a bitmap big enough. */
+    MVMuint64  named_used_bits;
+    MVMuint64 *named_used;
+    MVMuint16  named_used_size;
+
+    /* How many nameds were looked up so far; see MVMNamedHints. */
+    MVMuint16  named_lookups;
 
     /* The total argument count (including 2 for each
      * named arg). */
@@ -100,6 +135,7 @@ struct MVMArgInfo {
 };
 
 /* Argument processing context handling. */
+void MVM_callsite_try_intern(MVMThreadContext *tc, MVMCallsite **cs_ptr);
 void MVM_args_proc_init(MVMThreadContext *tc, MVMArgProcContext *ctx, MVMCallsite *callsite, MVMRegister *args);
 void MVM_args_proc_cleanup_for_cache(MVMThreadContext *tc, MVMArgProcContext *ctx);
 void MVM_args_proc_cleanup(MVMThreadContext *tc, MVMArgProcContext *ctx);
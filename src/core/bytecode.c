@@ -241,7 +241,7 @@ static MVMString ** deserialize_strings(MVMThreadContext *tc, MVMCompUnit *cu, R
         /* Ensure we can read in the string of this size, and decode
          * it if so. */
         ensure_can_read(tc, cu, rs, pos, ss);
-        MVM_ASSIGN_REF(tc, cu, strings[i], MVM_string_utf8_decode(tc, tc->instance->VMString, pos, ss));
+        MVM_ASSIGN_REF(tc, cu, strings[i], MVM_string_utf8_decode_wide(tc, tc->instance->VMString, pos, ss));
         pos += ss;
 
         /* Add alignment. */
@@ -469,8 +469,7 @@ static MVMCallsite ** deserialize_callsites(MVMThreadContext *tc, MVMCompUnit *c
 
         /* Allocate space for the callsite. */
         callsites[i] = malloc(sizeof(MVMCallsite));
-        if (elems)
-            callsites[i]->arg_flags = malloc(elems);
+        callsites[i]->arg_flags = elems ? malloc(elems) : NULL;
 
         /* Ensure we can read in a callsite of this size, and do so. */
         ensure_can_read(tc, cu, rs, pos, elems);
@@ -505,11 +504,16 @@ static MVMCallsite ** deserialize_callsites(MVMThreadContext *tc, MVMCompUnit *c
         callsites[i]->num_pos   = positionals;
         callsites[i]->arg_count = positionals + nameds;
         callsites[i]->has_flattening = has_flattening;
+        callsites[i]->flag_count = elems;
+        callsites[i]->num_named  = nameds / 2;
 
         /* Track maximum callsite size we've seen. (Used for now, though
          * in the end we probably should calculate it by frame.) */
         if (positionals + nameds > cu_body->max_callsite_size)
             cu_body->max_callsite_size = positionals + nameds;
+
+        /* Share the callsite with others of the same shape. */
+        MVM_callsite_try_intern(tc, &callsites[i]);
     }
 
     return callsites;
@@ -0,0 +1,75 @@
+#include "moarvm.h"
+
+/* Allocates a call stack region with room for at least the given size. */
+static MVMCallStackRegion * region_alloc(size_t size) {
+    MVMCallStackRegion *region = malloc(sizeof(MVMCallStackRegion));
+    if (size < MVM_CALLSTACK_REGION_SIZE)
+        size = MVM_CALLSTACK_REGION_SIZE;
+    region->start       = malloc(size);
+    region->alloc       = region->start;
+    region->alloc_limit = region->start + size;
+    region->prev        = NULL;
+    region->next        = NULL;
+    return region;
+}
+
+/* Frees a call stack region and all of those after it. */
+static void free_regions_from(MVMCallStackRegion *region) {
+    while (region) {
+        MVMCallStackRegion *next = region->next;
+        free(region->start);
+        free(region);
+        region = next;
+    }
+}
+
+/* Sets up the call stack of a thread with its first region. */
+void MVM_callstack_region_init(MVMThreadContext *tc) {
+    tc->stack_first = tc->stack_current = region_alloc(MVM_CALLSTACK_REGION_SIZE);
+}
+
+/* Allocates space for registers on the call stack. It is not zeroed. */
+MVMRegister * MVM_callstack_alloc(MVMThreadContext *tc, size_t size) {
+    MVMCallStackRegion *region = tc->stack_current;
+    char *result;
+
+    /* Keep things aligned for the registers. */
+    size = (size + sizeof(MVMRegister) - 1) & ~(sizeof(MVMRegister) - 1);
+
+    if (region->alloc_limit - region->alloc < (ptrdiff_t)size) {
+        /* Move on to the next region, replacing it if it's too small. */
+        MVMCallStackRegion *next = region->next;
+        if (!next || next->alloc_limit - next->start < (ptrdiff_t)size) {
+            free_regions_from(next);
+            next = region_alloc(size);
+            next->prev   = region;
+            region->next = next;
+        }
+        next->alloc = next->start;
+        tc->stack_current = region = next;
+    }
+
+    result = region->alloc;
+    region->alloc += size;
+    return (MVMRegister *)result;
+}
+
+/* Frees space on the call stack that was allocated by MVM_callstack_alloc,
+ * along with anything allocated after it. */
+void MVM_callstack_free(MVMThreadContext *tc, MVMRegister *ptr) {
+    MVMCallStackRegion *region = tc->stack_current;
+    char *to_free = (char *)ptr;
+    while (to_free < region->start || to_free >= region->alloc_limit) {
+        region = region->prev;
+        if (!region)
+            MVM_panic(1, "Freeing memory that is not on the call stack");
+    }
+    region->alloc = to_free;
+    tc->stack_current = region;
+}
+
+/* Frees all of the call stack regions of a thread. */
+void MVM_callstack_region_destroy_all(MVMThreadContext *tc) {
+    free_regions_from(tc->stack_first);
+    tc->stack_first = tc->stack_current = NULL;
+}
@@ -0,0 +1,23 @@
+/* The size of each region of the call stack, unless a frame needs more. */
+#define MVM_CALLSTACK_REGION_SIZE 131072
+
+/* A region of a thread's call stack. The working registers and argument
+ * buffers of the frames a thread is executing are bump-allocated in it,
+ * and freed again in reverse order as the frames return or are unwound.
+ * Regions form a doubly linked list; when one fills up, we move on to the
+ * next, and keep it around for later calls that need it again. */
+struct MVMCallStackRegion {
+    /* Start of the region, where we allocate next, and its end. */
+    char *start;
+    char *alloc;
+    char *alloc_limit;
+
+    /* The regions before and after this one. */
+    MVMCallStackRegion *prev;
+    MVMCallStackRegion *next;
+};
+
+void MVM_callstack_region_init(MVMThreadContext *tc);
+MVMRegister * MVM_callstack_alloc(MVMThreadContext *tc, size_t size);
+void MVM_callstack_free(MVMThreadContext *tc, MVMRegister *ptr);
+void MVM_callstack_region_destroy_all(MVMThreadContext *tc);
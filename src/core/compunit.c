@@ -34,6 +34,12 @@ MVMCompUnit * MVM_cu_map_from_file(MVMThreadContext *tc, char *filename) {
     /* close the filehandle. */
     apr_file_close(file_handle);
 
+    /* The compilation unit and everything unpacked from it are allocated
+     * straight into generation 2. They will live long anyway, and this way
+     * no GC run can happen, and move or free them, while the unit is only
+     * partly built and not referenced from anywhere. */
+    MVM_gc_allocate_gen2_default_set(tc);
+
     /* Create compilation unit data structure. */
     cu = (MVMCompUnit *)MVM_repr_alloc_init(tc, tc->instance->boot_types->BOOTCompUnit);
     cu->body.pool       = pool;
@@ -43,8 +49,13 @@ MVMCompUnit * MVM_cu_map_from_file(MVMThreadContext *tc, char *filename) {
     /* Process the input. */
     MVM_bytecode_unpack(tc, cu);
 
+    /* Restore normal GC allocation. */
+    MVM_gc_allocate_gen2_default_clear(tc);
+
     /* Resolve HLL config. */
-    cu->body.hll_config = MVM_hll_get_config_for(tc, cu->body.hll_name);
+    MVMROOT(tc, cu, {
+        cu->body.hll_config = MVM_hll_get_config_for(tc, cu->body.hll_name);
+    });
 
     /* Add the compilation unit to the head of the unit linked lists. */
     do {
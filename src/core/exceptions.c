@@ -52,7 +52,7 @@ static MVMFrameHandler * search_frame_handlers(MVMThreadContext *tc, MVMFrame *f
     if (f == tc->cur_frame)
         pc = (MVMuint32)(*tc->interp_cur_op - *tc->interp_bytecode_start);
     else
-        pc = (MVMuint32)(f->return_address - sf->body.bytecode);
+        pc = (MVMuint32)(f->return_address - sf->body.decoded_bytecode);
     for (i = 0; i < sf->body.num_handlers; i++) {
         if (sf->body.handlers[i].category_mask & cat)
             if (pc >= sf->body.handlers[i].start_offset && pc < sf->body.handlers[i].end_offset)
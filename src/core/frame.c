@@ -13,6 +13,9 @@ void prepare_and_verify_static_frame(MVMThreadContext *tc, MVMStaticFrame *stati
     /* Validate the bytecode. */
     MVM_validate_static_frame(tc, static_frame);
 
+    /* Produce the pre-decoded bytecode that the interpreter will run. */
+    MVM_predecode_static_frame(tc, static_frame);
+
     /* Obtain an index to each threadcontext's pool table */
     static_frame_body->pool_index = MVM_atomic_incr(&tc->instance->num_frame_pools);
     if (static_frame_body->pool_index >= tc->frame_pool_table_size) {
@@ -34,18 +37,29 @@ void prepare_and_verify_static_frame(MVMThreadContext *tc, MVMStaticFrame *stati
     static_frame_body->invoked = 1;
 }
 
-/* Increases the reference count of a frame. */
+/* Increases the reference count of a frame. While only one thread runs,
+ * no other thread can see the frame, so a plain increment will do. */
 MVMFrame * MVM_frame_inc_ref(MVMThreadContext *tc, MVMFrame *frame) {
-    MVM_atomic_incr(&frame->ref_count);
+    if (tc->instance->frames_shared)
+        MVM_atomic_incr(&frame->ref_count);
+    else
+        frame->ref_count++;
     return frame;
 }
 
+/* Decrements the reference count of a frame, returning what it was. */
+static AO_t decr_ref_count(MVMThreadContext *tc, MVMFrame *frame) {
+    if (tc->instance->frames_shared)
+        return MVM_atomic_decr(&frame->ref_count);
+    return frame->ref_count--;
+}
+
 /* Decreases the reference count of a frame. If it hits zero, then we can
  * free it. */
 void MVM_frame_dec_ref(MVMThreadContext *tc, MVMFrame *frame) {
-    /* MVM_atomic_dec returns what the count was before it decremented it
+    /* decr_ref_count returns what the count was before it decremented it
      * to zero, so we look for 1 here. */
-    while (MVM_atomic_decr(&frame->ref_count) == 1) {
+    while (decr_ref_count(tc, frame) == 1) {
         MVMuint32 pool_index = frame->static_info->body.pool_index;
         MVMFrame *node = tc->frame_pool_table[pool_index];
         MVMFrame *outer_to_decr = frame->outer;
@@ -56,10 +70,9 @@ void MVM_frame_dec_ref(MVMThreadContext *tc, MVMFrame *frame) {
                 free(frame->env);
                 frame->env = NULL;
             }
-            if (frame->work) {
-                MVM_args_proc_cleanup(tc, &frame->params);
-                free(frame->work);
-                frame->work = NULL;
+            if (frame->params.named_used) {
+                free(frame->params.named_used);
+                frame->params.named_used = NULL;
             }
             free(frame);
         }
@@ -116,8 +129,9 @@ void MVM_frame_invoke(MVMThreadContext *tc, MVMStaticFrame *static_frame,
     /* Store the code ref (NULL at the top-level). */
     frame->code_ref = code_ref;
 
-    /* Allocate space for lexicals and work area, copying the default lexical
-     * environment into place. */
+    /* Allocate space for lexicals, copying the default lexical environment
+     * into place. The work area only lives as long as the call, so it goes
+     * on the thread's call stack. */
     if (static_frame_body->env_size) {
         if (fresh)
             frame->env = malloc(static_frame_body->env_size);
@@ -127,8 +141,7 @@ void MVM_frame_invoke(MVMThreadContext *tc, MVMStaticFrame *static_frame,
         frame->env = NULL;
     }
     if (static_frame_body->work_size) {
-        if (fresh)
-            frame->work = malloc(static_frame_body->work_size);
+        frame->work = MVM_callstack_alloc(tc, static_frame_body->work_size);
         memset(frame->work, 0, static_frame_body->work_size);
     }
     else {
@@ -181,11 +194,10 @@ void MVM_frame_invoke(MVMThreadContext *tc, MVMStaticFrame *static_frame,
     if (frame->outer)
         MVM_frame_inc_ref(tc, frame->outer);
 
-    /* Caller is current frame in the thread context. */
-    if (tc->cur_frame)
-        frame->caller = MVM_frame_inc_ref(tc, tc->cur_frame);
-    else
-        frame->caller = NULL;
+    /* Caller is current frame in the thread context. We don't take a
+     * reference to it: it can't return before we do, and so it is kept
+     * alive by being a currently executing frame. */
+    frame->caller = tc->cur_frame;
 
     /* Initial reference count is 1 by virtue of it being the currently
      * executing frame. */
@@ -198,8 +210,8 @@ void MVM_frame_invoke(MVMThreadContext *tc, MVMStaticFrame *static_frame,
     /* Update interpreter and thread context, so next execution will use this
      * frame. */
     tc->cur_frame = frame;
-    *(tc->interp_cur_op) = static_frame_body->bytecode;
-    *(tc->interp_bytecode_start) = static_frame_body->bytecode;
+    *(tc->interp_cur_op) = static_frame_body->decoded_bytecode;
+    *(tc->interp_bytecode_start) = static_frame_body->decoded_bytecode;
     *(tc->interp_reg_base) = frame->work;
     *(tc->interp_cu) = static_frame_body->cu;
 }
@@ -253,24 +265,30 @@ static MVMuint64 return_or_unwind(MVMThreadContext *tc, MVMuint8 unwind) {
     if (prior)
         MVM_frame_dec_ref(tc, prior);
 
-    /* Clear up argument processing leftovers, if any. */
+    /* Clear up argument processing leftovers, if any, and pop the work
+     * area off the call stack. */
     if (returner->work) {
         MVM_args_proc_cleanup_for_cache(tc, &returner->params);
+        MVM_callstack_free(tc, returner->work);
+        returner->work = NULL;
+        returner->args = NULL;
     }
 
     /* signal to the GC to ignore ->work */
     returner->tc = NULL;
 
-    /* Switch back to the caller frame if there is one; we also need to
-     * decrement its reference count. */
+    /* We hold no reference to the caller, so the returner must not point
+     * at it once it is no longer executing. This includes thread entry
+     * frames, whose caller lives on another thread. */
+    returner->caller = NULL;
+
+    /* Switch back to the caller frame if there is one. */
     if (caller && returner != tc->thread_entry_frame) {
         tc->cur_frame = caller;
         *(tc->interp_cur_op) = caller->return_address;
-        *(tc->interp_bytecode_start) = caller->static_info->body.bytecode;
+        *(tc->interp_bytecode_start) = caller->static_info->body.decoded_bytecode;
         *(tc->interp_reg_base) = caller->work;
         *(tc->interp_cu) = caller->static_info->body.cu;
-        MVM_frame_dec_ref(tc, caller);
-        returner->caller = NULL;
 
         /* Handle any special return hooks. */
         if (caller->special_return) {
@@ -325,11 +343,87 @@ MVMObject * MVM_frame_takeclosure(MVMThreadContext *tc, MVMObject *code) {
     return (MVMObject *)closure;
 }
 
+/* Finds the lexical lookup cache of the op at the given offset in the
+ * bytecode of the current frame. Returns NULL if there is none, which is
+ * also the case once more than one thread runs: the caches live in static
+ * frames, which threads share. */
+MVMLexicalCache * MVM_frame_lexical_cache(MVMThreadContext *tc, MVMuint32 offset) {
+    MVMStaticFrameBody *static_frame_body = &tc->cur_frame->static_info->body;
+    MVMLexicalCache *caches = static_frame_body->lexical_caches;
+    MVMuint32 lo = 0, hi = static_frame_body->num_lexical_caches;
+    if (tc->instance->frames_shared)
+        return NULL;
+    while (lo < hi) {
+        MVMuint32 mid = (lo + hi) / 2;
+        if (caches[mid].offset < offset)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo < static_frame_body->num_lexical_caches && caches[lo].offset == offset
+        ? &caches[lo]
+        : NULL;
+}
+
+/* Looks up a lexical in a cache. The lexical is where it was found the last
+ * time if the name is the same, and the frames on the way to it (following
+ * the outer chain, or the caller chain if dynamic) are of the same static
+ * frames; those fully determine which lexical a name resolves to. Returns
+ * NULL if it's not in the cache. */
+static MVMRegister * lexical_cache_get(MVMThreadContext *tc, MVMLexicalCache *cache,
+        MVMString *name, MVMuint8 dynamic) {
+    MVMFrame *cur_frame = tc->cur_frame;
+    MVMuint32 i;
+    if (!cache || cache->name != name)
+        return NULL;
+    for (i = 0; cur_frame && cur_frame->static_info == cache->path[i]; i++) {
+        if (i == cache->hops)
+            return &cur_frame->env[cache->index];
+        cur_frame = dynamic ? cur_frame->caller : cur_frame->outer;
+    }
+    return NULL;
+}
+
+/* Records where a lexical was found in a cache, unless it was too far away
+ * for checking the way to it to be worth it. */
+static void lexical_cache_set(MVMThreadContext *tc, MVMLexicalCache *cache,
+        MVMString *name, MVMFrame *found, MVMuint32 index, MVMuint8 dynamic) {
+    MVMStaticFrame *owner;
+    MVMFrame *cur_frame = tc->cur_frame;
+    MVMuint32 hops = 0, i;
+    if (!cache)
+        return;
+    while (cur_frame != found) {
+        if (++hops > MVM_LEXICAL_CACHE_MAX_HOPS)
+            return;
+        cur_frame = dynamic ? cur_frame->caller : cur_frame->outer;
+    }
+    if (hops >= cache->path_size) {
+        cache->path_size = hops + 1;
+        cache->path = realloc(cache->path, cache->path_size * sizeof(MVMStaticFrame *));
+    }
+
+    /* The cache is held by the static frame of the current frame. */
+    owner = tc->cur_frame->static_info;
+    cur_frame = tc->cur_frame;
+    for (i = 0; i <= hops; i++) {
+        MVM_ASSIGN_REF(tc, owner, cache->path[i], cur_frame->static_info);
+        cur_frame = dynamic ? cur_frame->caller : cur_frame->outer;
+    }
+    MVM_ASSIGN_REF(tc, owner, cache->name, name);
+    cache->hops  = hops;
+    cache->index = index;
+}
+
 /* Looks up the address of the lexical with the specified name and the
  * specified type. An error is thrown if it does not exist or if the
- * type is incorrect */
-MVMRegister * MVM_frame_find_lexical_by_name(MVMThreadContext *tc, MVMString *name, MVMuint16 type) {
+ * type is incorrect. The cache may be NULL. */
+MVMRegister * MVM_frame_find_lexical_by_name(MVMThreadContext *tc, MVMString *name, MVMuint16 type,
+        MVMLexicalCache *cache) {
     MVMFrame *cur_frame = tc->cur_frame;
+    MVMRegister *cached = lexical_cache_get(tc, cache, name, 0);
+    if (cached)
+        return cached;
     MVM_string_flatten(tc, name);
     while (cur_frame != NULL) {
         MVMLexicalHashEntry *lexical_names = cur_frame->static_info->body.lexical_names;
@@ -341,8 +435,10 @@ MVMRegister * MVM_frame_find_lexical_by_name(MVMThreadContext *tc, MVMString *na
             MVM_HASH_GET(tc, lexical_names, name, entry)
 
             if (entry) {
-                if (cur_frame->static_info->body.lexical_types[entry->value] == type)
+                if (cur_frame->static_info->body.lexical_types[entry->value] == type) {
+                    lexical_cache_set(tc, cache, name, cur_frame, entry->value, 0);
                     return &cur_frame->env[entry->value];
+                }
                 else
                    MVM_exception_throw_adhoc(tc,
                         "Lexical with name '%s' has wrong type",
@@ -355,13 +451,20 @@ MVMRegister * MVM_frame_find_lexical_by_name(MVMThreadContext *tc, MVMString *na
         MVM_string_utf8_encode_C_string(tc, name));
 }
 
-/* Looks up the address of the lexical with the specified name and the
- * specified type. Returns null if it does not exist. */
-MVMRegister * MVM_frame_find_contextual_by_name(MVMThreadContext *tc, MVMString *name, MVMuint16 *type) {
+/* Looks up the address of the lexical with the specified name, searching
+ * the dynamic scope, and gives its type. Returns null if it does not exist.
+ * The cache may be NULL. */
+MVMRegister * MVM_frame_find_contextual_by_name(MVMThreadContext *tc, MVMString *name, MVMuint16 *type,
+        MVMLexicalCache *cache) {
     MVMFrame *cur_frame = tc->cur_frame;
+    MVMRegister *cached;
     if (!name) {
         MVM_exception_throw_adhoc(tc, "Contextual name cannot be null");
     }
+    if ((cached = lexical_cache_get(tc, cache, name, 1))) {
+        *type = cache->path[cache->hops]->body.lexical_types[cache->index];
+        return cached;
+    }
     MVM_string_flatten(tc, name);
     while (cur_frame != NULL) {
         MVMLexicalHashEntry *lexical_names = cur_frame->static_info->body.lexical_names;
@@ -372,6 +475,7 @@ MVMRegister * MVM_frame_find_contextual_by_name(MVMThreadContext *tc, MVMString
 
             if (entry) {
                 *type = cur_frame->static_info->body.lexical_types[entry->value];
+                lexical_cache_set(tc, cache, name, cur_frame, entry->value, 1);
                 return &cur_frame->env[entry->value];
             }
         }
@@ -380,9 +484,9 @@ MVMRegister * MVM_frame_find_contextual_by_name(MVMThreadContext *tc, MVMString
     return NULL;
 }
 
-MVMObject * MVM_frame_getdynlex(MVMThreadContext *tc, MVMString *name) {
+MVMObject * MVM_frame_getdynlex(MVMThreadContext *tc, MVMString *name, MVMLexicalCache *cache) {
     MVMuint16 type;
-    MVMRegister *lex_reg = MVM_frame_find_contextual_by_name(tc, name, &type);
+    MVMRegister *lex_reg = MVM_frame_find_contextual_by_name(tc, name, &type, cache);
     MVMObject *result = NULL, *result_type = NULL;
     if (lex_reg) {
         switch (type) {
@@ -432,9 +536,9 @@ MVMObject * MVM_frame_getdynlex(MVMThreadContext *tc, MVMString *name) {
     return result;
 }
 
-void MVM_frame_binddynlex(MVMThreadContext *tc, MVMString *name, MVMObject *value) {
+void MVM_frame_binddynlex(MVMThreadContext *tc, MVMString *name, MVMObject *value, MVMLexicalCache *cache) {
     MVMuint16 type;
-    MVMRegister *lex_reg = MVM_frame_find_contextual_by_name(tc, name, &type);
+    MVMRegister *lex_reg = MVM_frame_find_contextual_by_name(tc, name, &type, cache);
     if (!lex_reg) {
         MVM_exception_throw_adhoc(tc, "No contextual found with name '%s'",
             MVM_string_utf8_encode_C_string(tc, name));
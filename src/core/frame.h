@@ -10,6 +10,30 @@ struct MVMLexicalHashEntry {
     UT_hash_handle hash_handle;
 };
 
+/* The most frames a lexical lookup cache checks on the way to a lexical. */
+#define MVM_LEXICAL_CACHE_MAX_HOPS 64
+
+/* A cache for an op that looks up a lexical by name. It remembers where
+ * the lexical was found the last time: how many frames away, at which
+ * index, and the static frames of the frames on the way there. */
+struct MVMLexicalCache {
+    /* The offset of the op in the bytecode. */
+    MVMuint32 offset;
+
+    /* The number of frames walked past to find the lexical, and its index
+     * in the environment of the frame that has it. */
+    MVMuint32 hops;
+    MVMuint32 index;
+
+    /* The name that was looked up, or NULL if the cache is empty. */
+    MVMString *name;
+
+    /* The static frames of the frames on the way, ending with that of the
+     * frame that has the lexical; holds path_size of them. */
+    MVMStaticFrame **path;
+    MVMuint32 path_size;
+};
+
 /* Function pointer type of special return handler. These are used to allow
  * return to be intercepted in some way, for things that need to do multiple
  * calls into the runloop in some C-managed process. Essentially, instead of
@@ -106,10 +130,13 @@ MVMuint64 MVM_frame_try_unwind(MVMThreadContext *tc);
 MVMFrame * MVM_frame_inc_ref(MVMThreadContext *tc, MVMFrame *frame);
 void MVM_frame_dec_ref(MVMThreadContext *tc, MVMFrame *frame);
 MVMObject * MVM_frame_takeclosure(MVMThreadContext *tc, MVMObject *code);
-MVMRegister * MVM_frame_find_lexical_by_name(MVMThreadContext *tc, MVMString *name, MVMuint16 type);
-MVMRegister * MVM_frame_find_contextual_by_name(MVMThreadContext *tc, MVMString *name, MVMuint16 *type);
-MVMObject * MVM_frame_getdynlex(MVMThreadContext *tc, MVMString *name);
-void MVM_frame_binddynlex(MVMThreadContext *tc, MVMString *name, MVMObject *value);
+MVMLexicalCache * MVM_frame_lexical_cache(MVMThreadContext *tc, MVMuint32 offset);
+MVMRegister * MVM_frame_find_lexical_by_name(MVMThreadContext *tc, MVMString *name, MVMuint16 type,
+    MVMLexicalCache *cache);
+MVMRegister * MVM_frame_find_contextual_by_name(MVMThreadContext *tc, MVMString *name, MVMuint16 *type,
+    MVMLexicalCache *cache);
+MVMObject * MVM_frame_getdynlex(MVMThreadContext *tc, MVMString *name, MVMLexicalCache *cache);
+void MVM_frame_binddynlex(MVMThreadContext *tc, MVMString *name, MVMObject *value, MVMLexicalCache *cache);
 MVMRegister * MVM_frame_lexical(MVMThreadContext *tc, MVMFrame *f, MVMString *name);
 MVMuint16 MVM_frame_lexical_primspec(MVMThreadContext *tc, MVMFrame *f, MVMString *name);
 MVMObject * MVM_frame_find_invokee(MVMThreadContext *tc, MVMObject *code);
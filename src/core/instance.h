@@ -46,6 +46,11 @@ struct MVMInstance {
     /* The number of active user threads. */
     MVMuint16 num_user_threads;
 
+    /* Set once a thread other than the main one was started. Until then,
+     * all frames are only ever touched by the thread that created them, so
+     * their reference counts need not be updated atomically. */
+    MVMuint8 frames_shared;
+
     /* The KnowHOW meta-object; all other meta-objects (which are
      * built in user-space) are built out of this. */
     MVMObject *KnowHOW;
@@ -101,6 +106,70 @@ struct MVMInstance {
     AO_t gc_finish;
     /* The number of threads that have yet to acknowledge the finish. */
     AO_t gc_ack;
+    /* The number of threads that have yet to clean up their gen2 roots in
+     * a full collection. */
+    AO_t gc_gen2roots_pending;
+
+    /* Whether the current GC run collects the second generation too; set
+     * by the thread coordinating the run. */
+    MVMuint8 gc_full_collection;
+
+    /* GC tuning: the size each thread's nursery starts out at, the largest
+     * it may grow to, and the percentage by which the second generation may
+     * grow before it is collected. */
+    MVMuint32 gc_nursery_size;
+    MVMuint32 gc_nursery_max_size;
+    MVMuint32 gc_gen2_growth;
+
+    /* Whether the second generation is marked concurrently (in slices,
+     * between GC runs) rather than all in one full collection. */
+    MVMuint8 gc_concurrent_mark;
+
+    /* Whether full collections defragment the second generation, by moving
+     * the live objects out of its emptiest pages and freeing those. */
+    MVMuint8 gc_defrag;
+
+    /* Whether a concurrent marking cycle is in progress; set and cleared
+     * by the thread coordinating a GC run. Also the number of objects that
+     * were greyed in the cycle but not yet traced. */
+    MVMuint8 gc_marking;
+    AO_t gc_grey_pending;
+
+    /* Whether the current full collection is the remark that ends a
+     * concurrent marking cycle. */
+    MVMuint8 gc_remark;
+
+    /* Objects greyed by threads other than their owners in the current
+     * marking cycle, to be handed over to the owners at the next GC run,
+     * and the mutex for adding to them. */
+    MVMCollectable     **gc_foreign_grey;
+    MVMuint32            num_foreign_grey;
+    MVMuint32            alloc_foreign_grey;
+    apr_thread_mutex_t  *mutex_gc_foreign_grey;
+
+    /* Bytes promoted to the second generation since the last full
+     * collection, and bytes that were alive in it after that collection. */
+    AO_t gc_promoted_bytes;
+    AO_t gc_gen2_live_bytes;
+
+    /* Statistics about garbage collection, and where to log each run. */
+    MVMGCStats *gc_stats;
+
+    /* The file to write a heap snapshot to at the next GC run, if one was
+     * asked for; the run is then a full collection. */
+    void * volatile gc_snapshot;
+
+    /* Threads that can't take part in a GC run (because they are blocked
+     * or have exited) have their collection done by those that can. They
+     * are pooled here, linked through gc_next_stealable, and taken by the
+     * first collecting thread that runs out of work of its own. */
+    MVMThreadContext * volatile gc_stealable;
+
+    /* Collecting threads that have nothing to do wait on this condition
+     * until they are passed work, work they passed on is taken, or the
+     * run is done; the mutex goes with it. */
+    apr_thread_mutex_t *mutex_gc_progress;
+    apr_thread_cond_t  *cond_gc_progress;
 
     /* MVMThreads completed starting, running, and/or exited. */
     MVMThread *threads;
@@ -141,4 +210,14 @@ struct MVMInstance {
      * removes it from this when it gets GC'd. */
     MVMSerializationContextBody *sc_weakhash;
     apr_thread_mutex_t                  *mutex_sc_weakhash;
+
+    /* Op execution counts, merged from those of each thread as it ends;
+     * NULL unless op profiling is turned on. */
+    MVMOpProfile       *op_profile;
+    apr_thread_mutex_t *mutex_op_profile;
+
+    /* Interned callsites, so those of the same shape share a descriptor;
+     * and the mutex for adding to them. */
+    MVMCallsiteInterns *callsite_interns;
+    apr_thread_mutex_t *mutex_callsite_interns;
 };
@@ -3,12 +3,18 @@
  * do such a thing, and hopefully so that it happens often enough; note
  * that every call down to the allocator is also a sync point, so this
  * really only means we need to do this enough to make sure tight native
- * loops trigger it. */
+ * loops trigger it. The interpreter has them on backward branches, which
+ * any loop must take, and on invocations, to cover recursion. */
 #define GC_SYNC_POINT(tc) \
     if (tc->gc_status) { \
         MVM_gc_enter_from_interrupt(tc); \
     }
 
+/* The interpreter dispatches on a flat op index, made up of the bank and
+ * the op number within it. The bytecode stores the bank byte first. */
+#define MVM_OP_FLAT(bank, op)   (((bank) << 8) | (op))
+#define MVM_OP_FLAT_AT(pc)      MVM_OP_FLAT((pc)[0], (pc)[1])
+
 /* Different views of a register. */
 union MVMRegister {
     MVMObject         *o;
@@ -0,0 +1,2307 @@
+/* This file is generated from src/core/oplist by tools/update_ops.p6. */
+static const void * const LABELS[] = {
+    &&OP_no_op,
+    &&OP_goto,
+    &&OP_if_i,
+    &&OP_unless_i,
+    &&OP_if_n,
+    &&OP_unless_n,
+    &&OP_if_s,
+    &&OP_unless_s,
+    &&OP_if_s0,
+    &&OP_unless_s0,
+    &&OP_if_o,
+    &&OP_unless_o,
+    &&OP_set,
+    &&OP_extend_u8,
+    &&OP_extend_u16,
+    &&OP_extend_u32,
+    &&OP_extend_i8,
+    &&OP_extend_i16,
+    &&OP_extend_i32,
+    &&OP_trunc_u8,
+    &&OP_trunc_u16,
+    &&OP_trunc_u32,
+    &&OP_trunc_i8,
+    &&OP_trunc_i16,
+    &&OP_trunc_i32,
+    &&OP_extend_n32,
+    &&OP_trunc_n32,
+    &&OP_getlex,
+    &&OP_bindlex,
+    &&OP_getlex_ni,
+    &&OP_getlex_nn,
+    &&OP_getlex_ns,
+    &&OP_getlex_no,
+    &&OP_bindlex_ni,
+    &&OP_bindlex_nn,
+    &&OP_bindlex_ns,
+    &&OP_bindlex_no,
+    &&OP_getlex_ng,
+    &&OP_bindlex_ng,
+    &&OP_return_i,
+    &&OP_return_n,
+    &&OP_return_s,
+    &&OP_return_o,
+    &&OP_return,
+    &&OP_const_i8,
+    &&OP_const_i16,
+    &&OP_const_i32,
+    &&OP_const_i64,
+    &&OP_const_n32,
+    &&OP_const_n64,
+    &&OP_const_s,
+    &&OP_add_i,
+    &&OP_sub_i,
+    &&OP_mul_i,
+    &&OP_div_i,
+    &&OP_div_u,
+    &&OP_mod_i,
+    &&OP_mod_u,
+    &&OP_neg_i,
+    &&OP_abs_i,
+    &&OP_inc_i,
+    &&OP_inc_u,
+    &&OP_dec_i,
+    &&OP_dec_u,
+    &&OP_getcode,
+    &&OP_prepargs,
+    &&OP_arg_i,
+    &&OP_arg_n,
+    &&OP_arg_s,
+    &&OP_arg_o,
+    &&OP_invoke_v,
+    &&OP_invoke_i,
+    &&OP_invoke_n,
+    &&OP_invoke_s,
+    &&OP_invoke_o,
+    &&OP_add_n,
+    &&OP_sub_n,
+    &&OP_mul_n,
+    &&OP_div_n,
+    &&OP_neg_n,
+    &&OP_abs_n,
+    &&OP_eq_i,
+    &&OP_ne_i,
+    &&OP_lt_i,
+    &&OP_le_i,
+    &&OP_gt_i,
+    &&OP_ge_i,
+    &&OP_eq_n,
+    &&OP_ne_n,
+    &&OP_lt_n,
+    &&OP_le_n,
+    &&OP_gt_n,
+    &&OP_ge_n,
+    &&OP_argconst_i,
+    &&OP_argconst_n,
+    &&OP_argconst_s,
+    &&OP_checkarity,
+    &&OP_param_rp_i,
+    &&OP_param_rp_n,
+    &&OP_param_rp_s,
+    &&OP_param_rp_o,
+    &&OP_param_op_i,
+    &&OP_param_op_n,
+    &&OP_param_op_s,
+    &&OP_param_op_o,
+    &&OP_param_rn_i,
+    &&OP_param_rn_n,
+    &&OP_param_rn_s,
+    &&OP_param_rn_o,
+    &&OP_param_on_i,
+    &&OP_param_on_n,
+    &&OP_param_on_s,
+    &&OP_param_on_o,
+    &&OP_coerce_in,
+    &&OP_coerce_ni,
+    &&OP_band_i,
+    &&OP_bor_i,
+    &&OP_bxor_i,
+    &&OP_bnot_i,
+    &&OP_blshift_i,
+    &&OP_brshift_i,
+    &&OP_pow_i,
+    &&OP_pow_n,
+    &&OP_takeclosure,
+    &&OP_jumplist,
+    &&OP_caller,
+    &&OP_getdynlex,
+    &&OP_binddynlex,
+    &&OP_coerce_is,
+    &&OP_coerce_ns,
+    &&OP_coerce_si,
+    &&OP_coerce_sn,
+    &&OP_smrt_numify,
+    &&OP_smrt_strify,
+    &&OP_param_sp,
+    &&OP_param_sn,
+    &&OP_ifnonnull,
+    &&OP_cmp_i,
+    &&OP_cmp_n,
+    &&OP_not_i,
+    &&OP_setlexvalue,
+    &&OP_exception,
+    &&OP_handled,
+    &&OP_newexception,
+    &&OP_bindexmessage,
+    &&OP_bindexpayload,
+    &&OP_bindexcategory,
+    &&OP_getexmessage,
+    &&OP_getexpayload,
+    &&OP_getexcategory,
+    &&OP_throwdyn,
+    &&OP_throwlex,
+    &&OP_throwlexotic,
+    &&OP_throwcatdyn,
+    &&OP_throwcatlex,
+    &&OP_throwcatlexotic,
+    &&OP_die,
+    &&OP_newlexotic,
+    &&OP_lexoticresult,
+    &&OP_mod_n,
+    &&OP_usecapture,
+    &&OP_savecapture,
+    &&OP_captureposelems,
+    &&OP_captureposarg,
+    &&OP_captureposarg_i,
+    &&OP_captureposarg_n,
+    &&OP_captureposarg_s,
+    &&OP_captureposprimspec,
+    &&OP_invokewithcapture,
+    &&OP_multicacheadd,
+    &&OP_multicachefind,
+    &&OP_lexprimspec,
+    &&OP_ceil_n,
+    &&OP_floor_n,
+    &&OP_assign,
+    &&OP_assignunchecked,
+    &&OP_objprimspec,
+    &&OP_backtracestrings,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_sleep,
+    &&OP_say_I,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_concat_s,
+    &&OP_repeat_s,
+    &&OP_substr_s,
+    &&OP_index_s,
+    &&OP_graphs_s,
+    &&OP_codes_s,
+    &&OP_eq_s,
+    &&OP_ne_s,
+    &&OP_eqat_s,
+    &&OP_haveat_s,
+    &&OP_getcp_s,
+    &&OP_indexcp_s,
+    &&OP_uc,
+    &&OP_lc,
+    &&OP_tc,
+    &&OP_buftostr,
+    &&OP_strtobuf,
+    &&OP_decode_s,
+    &&OP_decode_b,
+    &&OP_decode,
+    &&OP_encode,
+    &&OP_split,
+    &&OP_join,
+    &&OP_replace,
+    &&OP_getcpbyname,
+    &&OP_indexat_scb,
+    &&OP_unipropcode,
+    &&OP_unipvalcode,
+    &&OP_hasuniprop,
+    &&OP_hasunipropc,
+    &&OP_concatr_s,
+    &&OP_splice_s,
+    &&OP_chars,
+    &&OP_chr,
+    &&OP_ordfirst,
+    &&OP_ordat,
+    &&OP_rindexfrom,
+    &&OP_escape,
+    &&OP_flip,
+    &&OP_iscclass,
+    &&OP_findcclass,
+    &&OP_findnotcclass,
+    &&OP_nfafromstatelist,
+    &&OP_nfarunproto,
+    &&OP_nfarunalt,
+    &&OP_flattenropes,
+    &&OP_gt_s,
+    &&OP_ge_s,
+    &&OP_lt_s,
+    &&OP_le_s,
+    &&OP_cmp_s,
+    &&OP_radix,
+    &&OP_eqatic_s,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_sin_n,
+    &&OP_asin_n,
+    &&OP_cos_n,
+    &&OP_acos_n,
+    &&OP_tan_n,
+    &&OP_atan_n,
+    &&OP_atan2_n,
+    &&OP_sec_n,
+    &&OP_asec_n,
+    &&OP_sinh_n,
+    &&OP_cosh_n,
+    &&OP_tanh_n,
+    &&OP_sech_n,
+    &&OP_sqrt_n,
+    &&OP_gcd_i,
+    &&OP_lcm_i,
+    &&OP_add_I,
+    &&OP_sub_I,
+    &&OP_mul_I,
+    &&OP_div_I,
+    &&OP_mod_I,
+    &&OP_neg_I,
+    &&OP_abs_I,
+    &&OP_inc_I,
+    &&OP_dec_I,
+    &&OP_cmp_I,
+    &&OP_eq_I,
+    &&OP_ne_I,
+    &&OP_lt_I,
+    &&OP_le_I,
+    &&OP_gt_I,
+    &&OP_ge_I,
+    &&OP_not_I,
+    &&OP_bor_I,
+    &&OP_bxor_I,
+    &&OP_band_I,
+    &&OP_bnot_I,
+    &&OP_blshift_I,
+    &&OP_brshift_I,
+    &&OP_pow_I,
+    &&OP_gcd_I,
+    &&OP_lcm_I,
+    &&OP_expmod_I,
+    &&OP_isprime_I,
+    &&OP_rand_I,
+    &&OP_coerce_Ii,
+    &&OP_coerce_In,
+    &&OP_coerce_Is,
+    &&OP_coerce_iI,
+    &&OP_coerce_nI,
+    &&OP_coerce_sI,
+    &&OP_isbig_I,
+    &&OP_base_I,
+    &&OP_radix_I,
+    &&OP_div_In,
+    &&OP_log_n,
+    &&OP_exp_n,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_knowhow,
+    &&OP_findmeth,
+    &&OP_findmeth_s,
+    &&OP_can,
+    &&OP_can_s,
+    &&OP_create,
+    &&OP_gethow,
+    &&OP_getwhat,
+    &&OP_atkey_i,
+    &&OP_atkey_n,
+    &&OP_atkey_s,
+    &&OP_atkey_o,
+    &&OP_bindkey_i,
+    &&OP_bindkey_n,
+    &&OP_bindkey_s,
+    &&OP_bindkey_o,
+    &&OP_existskey,
+    &&OP_deletekey,
+    &&OP_getwhere,
+    &&OP_eqaddr,
+    &&OP_reprname,
+    &&OP_isconcrete,
+    &&OP_atpos_i,
+    &&OP_atpos_n,
+    &&OP_atpos_s,
+    &&OP_atpos_o,
+    &&OP_bindpos_i,
+    &&OP_bindpos_n,
+    &&OP_bindpos_s,
+    &&OP_bindpos_o,
+    &&OP_push_i,
+    &&OP_push_n,
+    &&OP_push_s,
+    &&OP_push_o,
+    &&OP_pop_i,
+    &&OP_pop_n,
+    &&OP_pop_s,
+    &&OP_pop_o,
+    &&OP_shift_i,
+    &&OP_shift_n,
+    &&OP_shift_s,
+    &&OP_shift_o,
+    &&OP_unshift_i,
+    &&OP_unshift_n,
+    &&OP_unshift_s,
+    &&OP_unshift_o,
+    &&OP_splice,
+    &&OP___INVALID_1__,
+    &&OP_setelemspos,
+    &&OP_box_i,
+    &&OP_box_n,
+    &&OP_box_s,
+    &&OP_unbox_i,
+    &&OP_unbox_n,
+    &&OP_unbox_s,
+    &&OP_bindattr_i,
+    &&OP_bindattr_n,
+    &&OP_bindattr_s,
+    &&OP_bindattr_o,
+    &&OP_bindattrs_i,
+    &&OP_bindattrs_n,
+    &&OP_bindattrs_s,
+    &&OP_bindattrs_o,
+    &&OP_getattr_i,
+    &&OP_getattr_n,
+    &&OP_getattr_s,
+    &&OP_getattr_o,
+    &&OP_getattrs_i,
+    &&OP_getattrs_n,
+    &&OP_getattrs_s,
+    &&OP_getattrs_o,
+    &&OP_isnull,
+    &&OP_knowhowattr,
+    &&OP_iscoderef,
+    &&OP_null,
+    &&OP_clone,
+    &&OP_isnull_s,
+    &&OP_bootint,
+    &&OP_bootnum,
+    &&OP_bootstr,
+    &&OP_bootarray,
+    &&OP_boothash,
+    &&OP_sethllconfig,
+    &&OP_hllboxtype_i,
+    &&OP_hllboxtype_n,
+    &&OP_hllboxtype_s,
+    &&OP_elems,
+    &&OP_null_s,
+    &&OP_newtype,
+    &&OP_islist,
+    &&OP_ishash,
+    &&OP_iter,
+    &&OP_iterkey_s,
+    &&OP_iterval,
+    &&OP_getcodename,
+    &&OP_composetype,
+    &&OP_setmethcache,
+    &&OP_setmethcacheauth,
+    &&OP_settypecache,
+    &&OP_setinvokespec,
+    &&OP_isinvokable,
+    &&OP_iscont,
+    &&OP_decont,
+    &&OP_setboolspec,
+    &&OP_istrue,
+    &&OP_isfalse,
+    &&OP_istrue_s,
+    &&OP_isfalse_s,
+    &&OP_getcodeobj,
+    &&OP_setcodeobj,
+    &&OP_setcodename,
+    &&OP_forceouterctx,
+    &&OP_getcomp,
+    &&OP_bindcomp,
+    &&OP_getcurhllsym,
+    &&OP_bindcurhllsym,
+    &&OP_getwho,
+    &&OP_setwho,
+    &&OP_rebless,
+    &&OP_istype,
+    &&OP_ctx,
+    &&OP_ctxouter,
+    &&OP_ctxcaller,
+    &&OP_ctxlexpad,
+    &&OP_curcode,
+    &&OP_callercode,
+    &&OP_bootintarray,
+    &&OP_bootnumarray,
+    &&OP_bootstrarray,
+    &&OP_hlllist,
+    &&OP_hllhash,
+    &&OP_attrinited,
+    &&OP_setcontspec,
+    &&OP_existspos,
+    &&OP_gethllsym,
+    &&OP_freshcoderef,
+    &&OP_markcodestatic,
+    &&OP_markcodestub,
+    &&OP_getstaticcode,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_copy_f,
+    &&OP_append_f,
+    &&OP_rename_f,
+    &&OP_delete_f,
+    &&OP_chmod_f,
+    &&OP_exists_f,
+    &&OP_mkdir,
+    &&OP_rmdir,
+    &&OP_open_dir,
+    &&OP_read_dir,
+    &&OP_close_dir,
+    &&OP_open_fh,
+    &&OP_close_fh,
+    &&OP_read_fhs,
+    &&OP_read_fhbuf,
+    &&OP_slurp,
+    &&OP_spew,
+    &&OP_write_fhs,
+    &&OP_write_fhbuf,
+    &&OP_seek_fh,
+    &&OP_lock_fh,
+    &&OP_unlock_fh,
+    &&OP_flush_fh,
+    &&OP_sync_fh,
+    &&OP_pipe_fh,
+    &&OP_trunc_fh,
+    &&OP_eof_fh,
+    &&OP_getstdin,
+    &&OP_getstdout,
+    &&OP_getstderr,
+    &&OP_connect_sk,
+    &&OP_close_sk,
+    &&OP_bind_sk,
+    &&OP_listen_sk,
+    &&OP_accept_sk,
+    &&OP_send_sks,
+    &&OP_send_skbuf,
+    &&OP_recv_sks,
+    &&OP_recv_skbuf,
+    &&OP_getaddr_sk,
+    &&OP_hostname,
+    &&OP_nametoaddr,
+    &&OP_addrtoname,
+    &&OP_porttosvc,
+    &&OP_setencoding,
+    &&OP_print,
+    &&OP_say,
+    &&OP_readall_fh,
+    &&OP_tell_fh,
+    &&OP_stat,
+    &&OP_readline_fh,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_getenv,
+    &&OP_setenv,
+    &&OP_delenv,
+    &&OP_nametogid,
+    &&OP_gidtoname,
+    &&OP_nametouid,
+    &&OP_uidtoname,
+    &&OP_getusername,
+    &&OP_getuid,
+    &&OP_getgid,
+    &&OP_gethomedir,
+    &&OP_getencoding,
+    &&OP_procshell,
+    &&OP_procshellbg,
+    &&OP_procrun,
+    &&OP_procrunbg,
+    &&OP_prockill,
+    &&OP_procwait,
+    &&OP_procalive,
+    &&OP_detach,
+    &&OP_daemonize,
+    &&OP_chdir,
+    &&OP_rand_i,
+    &&OP_rand_n,
+    &&OP_time_i,
+    &&OP_clargs,
+    &&OP_newthread,
+    &&OP_jointhread,
+    &&OP_time_n,
+    &&OP_exit,
+    &&OP_loadbytecode,
+    &&OP_getenvhash,
+    &&OP_compilemasttofile,
+    &&OP_gcstats,
+    &&OP_heapsnapshot,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_sha1,
+    &&OP_createsc,
+    &&OP_scsetobj,
+    &&OP_scsetcode,
+    &&OP_scgetobj,
+    &&OP_scgethandle,
+    &&OP_scgetobjidx,
+    &&OP_scsetdesc,
+    &&OP_scobjcount,
+    &&OP_setobjsc,
+    &&OP_getobjsc,
+    &&OP_serialize,
+    &&OP_deserialize,
+    &&OP_wval,
+    &&OP_wval_wide,
+    &&OP_scwbdisable,
+    &&OP_scwbenable,
+    &&OP_pushcompsc,
+    &&OP_popcompsc,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_lt_i_if_i,
+    &&OP_lt_i_unless_i,
+    &&OP_const_i64_add_i,
+    &&OP_const_i64_add_i_lt_i_unless_i,
+    &&OP_getlex_decont,
+    &&OP_getlex_decont_findmeth,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+    &&OP_INVALID,
+};
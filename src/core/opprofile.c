@@ -0,0 +1,202 @@
+#include "moarvm.h"
+
+/* Op profiling counts how many times each op, and each pair of consecutive
+ * ops, was executed. It's turned on with the --profile-ops command line flag
+ * or by setting MVM_PROFILE_OPS in the environment, and the report is written
+ * to stderr when the VM exits. tools/superops.pl can read the op pairs from
+ * it, in order to suggest new superinstructions. */
+
+/* Allocates a profile with all of its counts at zero. */
+static MVMOpProfile * profile_alloc(MVMuint32 num_ops, MVMuint16 *op_numbers) {
+    MVMOpProfile *profile = malloc(sizeof(MVMOpProfile));
+    profile->num_ops    = num_ops;
+    profile->op_numbers = op_numbers;
+    profile->prev       = num_ops;
+    profile->ops        = calloc(num_ops, sizeof(MVMuint64));
+    profile->pairs      = calloc((size_t)num_ops * num_ops, sizeof(MVMuint64));
+    profile->next       = NULL;
+    return profile;
+}
+
+/* Frees a profile. The op number map is owned by the instance's. */
+static void profile_free(MVMOpProfile *profile) {
+    free(profile->ops);
+    free(profile->pairs);
+    free(profile);
+}
+
+/* Adds the counts of one profile to those of another. */
+static void profile_add(MVMOpProfile *to, MVMOpProfile *from) {
+    MVMuint32 i;
+    for (i = 0; i < from->num_ops; i++)
+        to->ops[i] += from->ops[i];
+    for (i = 0; i < from->num_ops * from->num_ops; i++)
+        to->pairs[i] += from->pairs[i];
+}
+
+/* Lock and unlock the instance's profile and its list of thread profiles. */
+static void lock_profiles(MVMInstance *instance) {
+    if (apr_thread_mutex_lock(instance->mutex_op_profile) != APR_SUCCESS)
+        MVM_panic(MVM_exitcode_threads, "Unable to lock op profile");
+}
+
+static void unlock_profiles(MVMInstance *instance) {
+    if (apr_thread_mutex_unlock(instance->mutex_op_profile) != APR_SUCCESS)
+        MVM_panic(MVM_exitcode_threads, "Unable to unlock op profile");
+}
+
+/* Turns on op profiling for an instance. This sets up the profile that
+ * threads merge their counts into, and the main thread's profile; any
+ * threads started later get their own when they are created. */
+void MVM_op_profile_start(MVMInstance *instance) {
+    MVMuint16 *op_numbers;
+    MVMuint32  num_banks = 0;
+    MVMuint32  num_ops   = 0;
+    MVMuint32  bank, op;
+
+    /* Number the ops, bank by bank. */
+    while (MVM_op_get_op(num_banks, 0))
+        num_banks++;
+    op_numbers = calloc(MVM_OP_FLAT(num_banks, 0), sizeof(MVMuint16));
+    for (bank = 0; bank < num_banks; bank++)
+        for (op = 0; MVM_op_get_op(bank, op); op++)
+            op_numbers[MVM_OP_FLAT(bank, op)] = num_ops++;
+
+    if (apr_thread_mutex_create(&instance->mutex_op_profile, APR_THREAD_MUTEX_DEFAULT,
+            instance->apr_pool) != APR_SUCCESS)
+        MVM_panic(MVM_exitcode_threads, "Initialization of op profile mutex failed");
+    instance->op_profile = profile_alloc(num_ops, op_numbers);
+    instance->main_thread->op_profile = MVM_op_profile_create(instance->main_thread);
+}
+
+/* Creates a profile for a thread to count the ops it executes in, and adds
+ * it to the instance's list of those of running threads. */
+MVMOpProfile * MVM_op_profile_create(MVMThreadContext *tc) {
+    MVMOpProfile *instance_profile = tc->instance->op_profile;
+    MVMOpProfile *profile = profile_alloc(instance_profile->num_ops,
+        instance_profile->op_numbers);
+    lock_profiles(tc->instance);
+    profile->next = instance_profile->next;
+    instance_profile->next = profile;
+    unlock_profiles(tc->instance);
+    return profile;
+}
+
+/* Counts an execution of the op with the given flat op index, and hands it
+ * back so the interpreter can go on to dispatch it. */
+MVMuint16 MVM_op_profile_count(MVMThreadContext *tc, MVMuint16 op) {
+    MVMOpProfile *profile = tc->op_profile;
+    MVMuint32 number = profile->op_numbers[op];
+    profile->ops[number]++;
+    if (profile->prev != profile->num_ops)
+        profile->pairs[profile->prev * profile->num_ops + number]++;
+    profile->prev = number;
+    return op;
+}
+
+/* Adds the counts of a thread to those of its instance, and frees the
+ * thread's profile. Called when the thread context is destroyed. */
+void MVM_op_profile_merge(MVMThreadContext *tc) {
+    MVMOpProfile *profile = tc->op_profile;
+    MVMOpProfile *prev;
+
+    if (!profile)
+        return;
+    lock_profiles(tc->instance);
+    prev = tc->instance->op_profile;
+    while (prev->next != profile)
+        prev = prev->next;
+    prev->next = profile->next;
+    profile_add(tc->instance->op_profile, profile);
+    unlock_profiles(tc->instance);
+
+    profile_free(profile);
+    tc->op_profile = NULL;
+}
+
+/* An entry in the report: a count, and the op or pair of ops it is for. */
+typedef struct {
+    MVMuint64 count;
+    MVMuint32 index;
+} ReportEntry;
+
+/* Sorts report entries, most executed first. */
+static int compare_entries(const void *a, const void *b) {
+    const ReportEntry *ea = (const ReportEntry *)a;
+    const ReportEntry *eb = (const ReportEntry *)b;
+    if (ea->count != eb->count)
+        return ea->count < eb->count ? 1 : -1;
+    return ea->index < eb->index ? -1 : ea->index > eb->index;
+}
+
+/* Collects the non-zero counts into a sorted list of entries. */
+static ReportEntry * sorted_entries(MVMuint64 *counts, MVMuint32 num_counts, MVMuint32 *num_entries) {
+    ReportEntry *entries = malloc(num_counts * sizeof(ReportEntry));
+    MVMuint32 i, n = 0;
+    for (i = 0; i < num_counts; i++) {
+        if (counts[i]) {
+            entries[n].count = counts[i];
+            entries[n].index = i;
+            n++;
+        }
+    }
+    qsort(entries, n, sizeof(ReportEntry), compare_entries);
+    *num_entries = n;
+    return entries;
+}
+
+/* Writes the report of the instance's op profile to stderr. The counts of
+ * threads that are still running are included as they stand, so that the
+ * report is complete when the exit op ends the process under them. */
+void MVM_op_profile_report(MVMInstance *instance) {
+    MVMOpProfile *profile = profile_alloc(instance->op_profile->num_ops,
+        instance->op_profile->op_numbers);
+    MVMOpProfile *running;
+    MVMuint32     num_ops = profile->num_ops;
+    const char  **names   = malloc(num_ops * sizeof(char *));
+    MVMuint64     total   = 0;
+    MVMuint64     total_pairs = 0;
+    ReportEntry  *entries;
+    MVMuint32     num_entries, bank, op, i;
+
+    lock_profiles(instance);
+    profile_add(profile, instance->op_profile);
+    for (running = instance->op_profile->next; running; running = running->next)
+        profile_add(profile, running);
+    unlock_profiles(instance);
+
+    for (bank = 0; MVM_op_get_op(bank, 0); bank++)
+        for (op = 0; MVM_op_get_op(bank, op); op++)
+            names[profile->op_numbers[MVM_OP_FLAT(bank, op)]] = MVM_op_get_op(bank, op)->name;
+    for (i = 0; i < num_ops; i++)
+        total += profile->ops[i];
+    for (i = 0; i < num_ops * num_ops; i++)
+        total_pairs += profile->pairs[i];
+
+    fprintf(stderr, "MoarVM op profile: %llu ops executed\n\nOps:\n", (unsigned long long)total);
+    entries = sorted_entries(profile->ops, num_ops, &num_entries);
+    for (i = 0; i < num_entries; i++)
+        fprintf(stderr, "%14llu  %6.2f%%  %s\n", (unsigned long long)entries[i].count,
+            100.0 * entries[i].count / total, names[entries[i].index]);
+    free(entries);
+
+    fprintf(stderr, "\nOp pairs:\n");
+    entries = sorted_entries(profile->pairs, num_ops * num_ops, &num_entries);
+    for (i = 0; i < num_entries; i++)
+        fprintf(stderr, "%14llu  %6.2f%%  %s %s\n", (unsigned long long)entries[i].count,
+            100.0 * entries[i].count / total_pairs,
+            names[entries[i].index / num_ops], names[entries[i].index % num_ops]);
+    free(entries);
+
+    free(names);
+    profile_free(profile);
+}
+
+/* Frees the instance's profile. Threads still running at this point keep
+ * their own profiles. */
+void MVM_op_profile_destroy(MVMInstance *instance) {
+    free(instance->op_profile->op_numbers);
+    profile_free(instance->op_profile);
+    instance->op_profile = NULL;
+    apr_thread_mutex_destroy(instance->mutex_op_profile);
+}
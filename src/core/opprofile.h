@@ -0,0 +1,30 @@
+/* Counts of how often ops, and pairs of consecutive ops, were executed.
+ * Each thread has its own, which it merges into the instance's when it
+ * ends. Ops are numbered densely here, rather than by flat op index, to
+ * keep the table of pairs small. */
+struct MVMOpProfile {
+    /* The number of ops, and the map from flat op index to op number. The
+     * map is shared by all of the profiles of an instance. */
+    MVMuint32  num_ops;
+    MVMuint16 *op_numbers;
+
+    /* The number of the op executed last, for counting pairs; num_ops if
+     * no op was executed yet. */
+    MVMuint32  prev;
+
+    /* Execution counts of each op, and of each pair of ops (indexed by the
+     * previous op times num_ops plus the op). */
+    MVMuint64 *ops;
+    MVMuint64 *pairs;
+
+    /* The next profile in the list of those of running threads. In the
+     * instance's profile, this is the head of that list. */
+    MVMOpProfile *next;
+};
+
+void MVM_op_profile_start(MVMInstance *instance);
+MVMOpProfile * MVM_op_profile_create(MVMThreadContext *tc);
+MVMuint16 MVM_op_profile_count(MVMThreadContext *tc, MVMuint16 op);
+void MVM_op_profile_merge(MVMThreadContext *tc);
+void MVM_op_profile_report(MVMInstance *instance);
+void MVM_op_profile_destroy(MVMInstance *instance);
@@ -2039,10 +2039,9 @@ static MVMOpInfo MVM_op_info_object[] = {
         { MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_int64, MVM_operand_read_reg | MVM_operand_int64 }
     },
     {
-        MVM_OP_gethllmasttypes,
-        "gethllmasttypes",
-        1,
-        { MVM_operand_write_reg | MVM_operand_obj }
+        MVM_OP___INVALID_1__,
+        "__INVALID_1__",
+        0,
     },
     {
         MVM_OP_setelemspos,
@@ -3096,6 +3095,18 @@ static MVMOpInfo MVM_op_info_processthread[] = {
         2,
         { MVM_operand_read_reg | MVM_operand_obj, MVM_operand_read_reg | MVM_operand_str }
     },
+    {
+        MVM_OP_gcstats,
+        "gcstats",
+        1,
+        { MVM_operand_write_reg | MVM_operand_obj }
+    },
+    {
+        MVM_OP_heapsnapshot,
+        "heapsnapshot",
+        1,
+        { MVM_operand_read_reg | MVM_operand_str }
+    },
 };
 static MVMOpInfo MVM_op_info_serialization[] = {
     {
@@ -3213,6 +3224,38 @@ static MVMOpInfo MVM_op_info_serialization[] = {
         { MVM_operand_write_reg | MVM_operand_obj }
     },
 };
+static MVMOpInfo MVM_op_info_superinstructions[] = {
+    {
+        MVM_OP_lt_i_if_i,
+        "lt_i_if_i",
+        0,
+    },
+    {
+        MVM_OP_lt_i_unless_i,
+        "lt_i_unless_i",
+        0,
+    },
+    {
+        MVM_OP_const_i64_add_i,
+        "const_i64_add_i",
+        0,
+    },
+    {
+        MVM_OP_const_i64_add_i_lt_i_unless_i,
+        "const_i64_add_i_lt_i_unless_i",
+        0,
+    },
+    {
+        MVM_OP_getlex_decont,
+        "getlex_decont",
+        0,
+    },
+    {
+        MVM_OP_getlex_decont_findmeth,
+        "getlex_decont_findmeth",
+        0,
+    },
+};
 
 static MVMOpInfo *MVM_op_info[] = {
     MVM_op_info_primitives,
@@ -3223,9 +3266,10 @@ static MVMOpInfo *MVM_op_info[] = {
     MVM_op_info_io,
     MVM_op_info_processthread,
     MVM_op_info_serialization,
+    MVM_op_info_superinstructions,
 };
 
-static unsigned char MVM_op_banks = 8;
+static unsigned char MVM_op_banks = 9;
 
 static unsigned char MVM_opcounts_by_bank[] = {
     178,
@@ -3234,8 +3278,9 @@ static unsigned char MVM_opcounts_by_bank[] = {
     57,
     139,
     51,
-    33,
+    35,
     19,
+    6,
 };
 
 MVMOpInfo * MVM_op_get_op(unsigned char bank, unsigned char op) {
@@ -9,6 +9,7 @@
 #define MVM_OP_BANK_io 5
 #define MVM_OP_BANK_processthread 6
 #define MVM_OP_BANK_serialization 7
+#define MVM_OP_BANK_superinstructions 8
 
 /* Op name defines for bank primitives. */
 #define MVM_OP_no_op 0
@@ -356,7 +357,7 @@
 #define MVM_OP_unshift_s 44
 #define MVM_OP_unshift_o 45
 #define MVM_OP_splice 46
-#define MVM_OP_gethllmasttypes 47
+#define MVM_OP___INVALID_1__ 47
 #define MVM_OP_setelemspos 48
 #define MVM_OP_box_i 49
 #define MVM_OP_box_n 50
@@ -536,6 +537,8 @@
 #define MVM_OP_loadbytecode 30
 #define MVM_OP_getenvhash 31
 #define MVM_OP_compilemasttofile 32
+#define MVM_OP_gcstats 33
+#define MVM_OP_heapsnapshot 34
 
 /* Op name defines for bank serialization. */
 #define MVM_OP_sha1 0
@@ -558,4 +561,12 @@
 #define MVM_OP_pushcompsc 17
 #define MVM_OP_popcompsc 18
 
+/* Op name defines for bank superinstructions. */
+#define MVM_OP_lt_i_if_i 0
+#define MVM_OP_lt_i_unless_i 1
+#define MVM_OP_const_i64_add_i 2
+#define MVM_OP_const_i64_add_i_lt_i_unless_i 3
+#define MVM_OP_getlex_decont 4
+#define MVM_OP_getlex_decont_findmeth 5
+
 MVMOpInfo * MVM_op_get_op(unsigned char bank, unsigned char op);
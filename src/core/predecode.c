@@ -0,0 +1,170 @@
+#include "moarvm.h"
+
+/* Pre-decoding turns the bytecode of a static frame into the form that the
+ * interpreter actually runs. It takes place once per static frame, after it
+ * was validated, and works on a copy; the original bytecode is left alone,
+ * so that it can be dumped or validated again (for example, when the static
+ * frame is cloned).
+ *
+ * Every instruction keeps its size and its operands stay where they were.
+ * That way, branch targets, handler and annotation offsets, and return
+ * addresses all mean the same in the pre-decoded stream as in the original.
+ * What changes is the op itself: the bank and op bytes are replaced by the
+ * flat op index, stored as a native 16-bit value, so the interpreter gets
+ * the index of the next op's handler with a single load.
+ *
+ * Only the op is pre-decoded; operands are not. Branch targets stay 32-bit
+ * offsets from the start of the bytecode, as an absolute pointer would not
+ * fit in the operand without moving everything after it. Registers stay as
+ * indexes, rather than being scaled to byte offsets: indexed addressing
+ * makes the scaling free on the machines we build for, and 16-bit byte
+ * offsets would cap frames at 8192 registers. The interpreter thus still
+ * reads operands through GET_REG, GET_UI32 and friends.
+ *
+ * Common sequences of ops are then fused into superinstructions, by putting
+ * the superinstruction in place of the first op of the sequence. The ops it
+ * covers are left as they are, so a branch into the middle of a sequence
+ * still finds them there and runs them one by one.
+ *
+ * Finally, each op that looks up a lexical by name gets a cache, which the
+ * interpreter finds by the op's offset. */
+
+/* A superinstruction and the sequence of ops it replaces. */
+#define MVM_SUPEROP_MAX_OPS 4
+typedef struct {
+    MVMuint16 fused;
+    MVMuint16 num_ops;
+    MVMuint16 ops[MVM_SUPEROP_MAX_OPS];
+} MVMSuperOp;
+
+#define PRIM(name)  MVM_OP_FLAT(MVM_OP_BANK_primitives, MVM_OP_ ## name)
+#define OBJ(name)   MVM_OP_FLAT(MVM_OP_BANK_object, MVM_OP_ ## name)
+#define SUPER(name) MVM_OP_FLAT(MVM_OP_BANK_superinstructions, MVM_OP_ ## name)
+
+/* The superinstructions we form; these must match those in the oplist. We
+ * try them in order, so longer sequences come before their prefixes. */
+static const MVMSuperOp superops[] = {
+    { SUPER(const_i64_add_i_lt_i_unless_i), 4,
+        { PRIM(const_i64), PRIM(add_i), PRIM(lt_i), PRIM(unless_i) } },
+    { SUPER(getlex_decont_findmeth), 3,
+        { PRIM(getlex), OBJ(decont), OBJ(findmeth) } },
+    { SUPER(lt_i_if_i), 2,
+        { PRIM(lt_i), PRIM(if_i) } },
+    { SUPER(lt_i_unless_i), 2,
+        { PRIM(lt_i), PRIM(unless_i) } },
+    { SUPER(const_i64_add_i), 2,
+        { PRIM(const_i64), PRIM(add_i) } },
+    { SUPER(getlex_decont), 2,
+        { PRIM(getlex), OBJ(decont) } },
+};
+
+/* Works out the size of an operand in the bytecode stream. */
+static MVMuint32 operand_size(MVMuint8 operand) {
+    switch (operand & MVM_operand_rw_mask) {
+        case MVM_operand_read_reg:
+        case MVM_operand_write_reg:
+            return 2;
+        case MVM_operand_read_lex:
+        case MVM_operand_write_lex:
+            return 4;
+    }
+    switch (operand & MVM_operand_type_mask) {
+        case MVM_operand_int8:      return 1;
+        case MVM_operand_int16:     return 2;
+        case MVM_operand_int32:     return 4;
+        case MVM_operand_int64:     return 8;
+        case MVM_operand_num32:     return 4;
+        case MVM_operand_num64:     return 8;
+        case MVM_operand_str:       return 2;
+        case MVM_operand_ins:       return 4;
+        case MVM_operand_coderef:   return 2;
+        case MVM_operand_callsite:  return 2;
+    }
+    return 0;
+}
+
+/* Tells whether an op looks up a lexical by name. */
+static MVMuint32 is_lexical_by_name(MVMuint16 op) {
+    switch (op) {
+        case PRIM(getlex_ni): case PRIM(getlex_nn): case PRIM(getlex_ns): case PRIM(getlex_no):
+        case PRIM(bindlex_ni): case PRIM(bindlex_nn): case PRIM(bindlex_ns): case PRIM(bindlex_no):
+        case PRIM(getdynlex): case PRIM(binddynlex):
+            return 1;
+    }
+    return 0;
+}
+
+/* Looks for a superinstruction for the ops starting at the given one, and
+ * puts it in place of that op if there is one. The ops are those of the
+ * original bytecode, so earlier fusions do not get in the way. */
+static void fuse(MVMuint8 *decoded, MVMuint16 *ops, MVMuint32 *offsets,
+        MVMuint32 start, MVMuint32 num_ops) {
+    MVMuint32 i, j;
+    for (i = 0; i < sizeof(superops) / sizeof(MVMSuperOp); i++) {
+        const MVMSuperOp *so = &superops[i];
+        if (start + so->num_ops > num_ops)
+            continue;
+        for (j = 0; j < so->num_ops; j++)
+            if (ops[start + j] != so->ops[j])
+                break;
+        if (j == so->num_ops) {
+            *((MVMuint16 *)(decoded + offsets[start])) = so->fused;
+            return;
+        }
+    }
+}
+
+/* Produces the pre-decoded bytecode for a static frame. The frame must have
+ * been validated already, so we trust the ops and their operands. */
+void MVM_predecode_static_frame(MVMThreadContext *tc, MVMStaticFrame *static_frame) {
+    MVMStaticFrameBody *static_frame_body = &static_frame->body;
+    MVMuint32 bytecode_size = static_frame_body->bytecode_size;
+    MVMuint8 *decoded = malloc(bytecode_size);
+    MVMuint8 *cur_op = decoded;
+    MVMuint8 *bytecode_end = decoded + bytecode_size;
+
+    /* Every op takes at least two bytes, which bounds how many there are. */
+    MVMuint16 *ops = malloc((bytecode_size / 2) * sizeof(MVMuint16));
+    MVMuint32 *offsets = malloc((bytecode_size / 2) * sizeof(MVMuint32));
+    MVMuint32 num_ops = 0;
+    MVMuint32 num_caches = 0;
+    MVMuint32 i;
+
+    memcpy(decoded, static_frame_body->bytecode, bytecode_size);
+
+    /* Decode the ops, noting where each of them is. */
+    while (cur_op < bytecode_end) {
+        MVMOpInfo *op_info = MVM_op_get_op(cur_op[0], cur_op[1]);
+        ops[num_ops] = MVM_OP_FLAT_AT(cur_op);
+        offsets[num_ops] = cur_op - decoded;
+        *((MVMuint16 *)cur_op) = ops[num_ops];
+        num_ops++;
+        cur_op += 2;
+        for (i = 0; i < op_info->num_operands; i++)
+            cur_op += operand_size(op_info->operands[i]);
+    }
+
+    /* Form superinstructions. Op profiles are about the bytecode as it was
+     * compiled, so we leave them out when profiling. */
+    if (!tc->instance->op_profile)
+        for (i = 0; i < num_ops; i++)
+            fuse(decoded, ops, offsets, i, num_ops);
+
+    /* Set up the lexical lookup caches. */
+    for (i = 0; i < num_ops; i++)
+        if (is_lexical_by_name(ops[i]))
+            num_caches++;
+    if (num_caches) {
+        MVMLexicalCache *caches = calloc(num_caches, sizeof(MVMLexicalCache));
+        num_caches = 0;
+        for (i = 0; i < num_ops; i++)
+            if (is_lexical_by_name(ops[i]))
+                caches[num_caches++].offset = offsets[i];
+        static_frame_body->lexical_caches = caches;
+    }
+    static_frame_body->num_lexical_caches = num_caches;
+
+    free(ops);
+    free(offsets);
+    static_frame_body->decoded_bytecode = decoded;
+}
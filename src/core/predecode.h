@@ -0,0 +1 @@
+void MVM_predecode_static_frame(MVMThreadContext *tc, MVMStaticFrame *static_frame);
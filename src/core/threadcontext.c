@@ -10,10 +10,13 @@ MVMThreadContext * MVM_tc_create(MVMInstance *instance) {
     tc->instance = instance;
 
     /* Set up GC nursery. */
-    tc->nursery_fromspace   = calloc(1, MVM_NURSERY_SIZE);
-    tc->nursery_tospace     = calloc(1, MVM_NURSERY_SIZE);
-    tc->nursery_alloc       = tc->nursery_tospace;
-    tc->nursery_alloc_limit = (char *)tc->nursery_alloc + MVM_NURSERY_SIZE;
+    tc->nursery_size           = instance->gc_nursery_size;
+    tc->nursery_fromspace_size = tc->nursery_size;
+    tc->nursery_tospace_size   = tc->nursery_size;
+    tc->nursery_fromspace      = calloc(1, tc->nursery_fromspace_size);
+    tc->nursery_tospace        = calloc(1, tc->nursery_tospace_size);
+    tc->nursery_alloc          = tc->nursery_tospace;
+    tc->nursery_alloc_limit    = (char *)tc->nursery_alloc + tc->nursery_tospace_size;
 
     /* Set up temporary root handling. */
     tc->num_temproots   = 0;
@@ -34,11 +37,21 @@ MVMThreadContext * MVM_tc_create(MVMInstance *instance) {
     tc->frame_pool_table_size = MVMInitialFramePoolTableSize;
     tc->frame_pool_table = calloc(MVMInitialFramePoolTableSize, sizeof(MVMFrame *));
 
+    /* Set up the call stack. */
+    MVM_callstack_region_init(tc);
+
+    /* Set up the table of named argument lookup hints. */
+    tc->named_hints = calloc(MVM_NAMED_HINT_SETS, sizeof(MVMNamedHints));
+
     /* Create a CallCapture for usecapture instructions in this thread (needs
      * special handling in initial thread as this runs before bootstrap). */
     if (instance->CallCapture)
         tc->cur_usecapture = MVM_repr_alloc_init(tc, instance->CallCapture);
 
+    /* Count the ops this thread executes, if we're profiling them. */
+    if (instance->op_profile)
+        tc->op_profile = MVM_op_profile_create(tc);
+
     return tc;
 }
 
@@ -55,10 +68,20 @@ void MVM_tc_destroy(MVMThreadContext *tc) {
     /* Destroy the second generation allocator. */
     MVM_gc_gen2_destroy(tc->instance, tc->gen2);
 
+    /* Free the call stack and the named argument lookup hints. */
+    MVM_callstack_region_destroy_all(tc);
+    free(tc->named_hints);
+
     /* Free the threads work container */
     if (tc->gc_work)
         free(tc->gc_work);
 
+    /* Free the list of objects still to trace in a marking cycle. */
+    free(tc->gc_grey);
+
+    /* Hand any op counts over to the instance. */
+    MVM_op_profile_merge(tc);
+
     /* Free the thread context itself. */
     memset(tc, 0, sizeof(MVMThreadContext));
     free(tc);
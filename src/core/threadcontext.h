@@ -97,6 +97,31 @@ struct MVMThreadContext {
      * allocate new ones. */
     void *nursery_tospace;
 
+    /* The sizes of the two semispaces, and the size the nursery is being
+     * adapted to. After the nursery size changes, the two semispaces have
+     * different sizes until the next collection. */
+    MVMuint32 nursery_fromspace_size;
+    MVMuint32 nursery_tospace_size;
+    MVMuint32 nursery_size;
+
+    /* Bytes promoted from this thread's nursery in the current GC run. */
+    MVMuint64 gc_promoted_bytes;
+
+    /* Bytes of this thread's second generation found alive in the current
+     * full collection. */
+    MVMuint64 gc_gen2_marked_bytes;
+
+    /* Objects of this thread's second generation that were marked in the
+     * current concurrent marking cycle, but whose references were not yet
+     * traced. */
+    MVMCollectable **gc_grey;
+    MVMuint32        num_gc_grey;
+    MVMuint32        alloc_gc_grey;
+
+    /* Objects greyed by other threads that we took from the instance at
+     * the start of a GC run, to be freed once it is over. */
+    MVMCollectable **gc_foreign_taken;
+
     /* The second GC generation allocator. */
     MVMGen2Allocator *gen2;
 
@@ -137,18 +162,33 @@ struct MVMThreadContext {
     MVMuint32                gc_work_size;
     MVMuint32                gc_work_count;
 
+    /* The next thread in the pool of those whose work may be taken by any
+     * collecting thread. */
+    MVMThreadContext *gc_next_stealable;
+
     /* Pool table of chains of frames for each static frame. */
     MVMFrame **frame_pool_table;
 
     /* Size of the pool table, so it can grow on demand. */
     MVMuint32          frame_pool_table_size;
 
+    /* The first region of the call stack that the working registers of
+     * frames are allocated in, and the region we're allocating in now. */
+    MVMCallStackRegion *stack_first;
+    MVMCallStackRegion *stack_current;
+
     /* Serialization context write barrier disabled depth (anything non-zero
      * means disabled). */
     MVMint32           sc_wb_disable_depth;
 
     /* Any serialization contexts we are compiling. */
     MVMObject     *compiling_scs;
+
+    /* The op execution counts of this thread, if op profiling is on. */
+    MVMOpProfile  *op_profile;
+
+    /* Hints for looking up named arguments, by callsite. */
+    MVMNamedHints *named_hints;
 };
 
 MVMThreadContext * MVM_tc_create(MVMInstance *instance);
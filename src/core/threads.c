@@ -21,9 +21,7 @@ static void thread_initial_invoke(MVMThreadContext *tc, void *data) {
     thread->body.invokee = NULL;
 
     /* Dummy, 0-arg callsite. */
-    ts->no_arg_callsite.arg_flags = NULL;
-    ts->no_arg_callsite.arg_count = 0;
-    ts->no_arg_callsite.num_pos   = 0;
+    memset(&ts->no_arg_callsite, 0, sizeof(MVMCallsite));
 
     /* Create initial frame, which sets up all of the interpreter state also. */
     STABLE(invokee)->invoke(tc, invokee, &ts->no_arg_callsite, NULL);
@@ -103,7 +101,10 @@ MVMObject * MVM_thread_start(MVMThreadContext *tc, MVMObject *invokee, MVMObject
          * since it must survive to be the dynamic scope of where the thread was
          * started, and there's no promises that the thread won't start before
          * the code creating the thread returns. The count is decremented when
-         * the thread is done. */
+         * the thread is done. From here on, frames may be seen by more than
+         * one thread, so their reference counts are kept atomically; creating
+         * the thread makes sure it sees this. */
+        tc->instance->frames_shared = 1;
         ts = malloc(sizeof(ThreadStart));
         ts->tc = child_tc;
         ts->caller = MVM_frame_inc_ref(tc, tc->cur_frame);
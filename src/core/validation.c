@@ -74,6 +74,12 @@ void MVM_validate_static_frame(MVMThreadContext *tc, MVMStaticFrame *static_fram
                 "Bytecode validation error: non-existent operation bank %u op %u",
                 bank_num, op_num);
         }
+        if (bank_num == MVM_OP_BANK_superinstructions) {
+            cleanup_all(tc, labels);
+            MVM_exception_throw_adhoc(tc,
+                "Bytecode validation error: superinstruction '%s' may not appear in bytecode",
+                op_info->name);
+        }
         if (num_jumplist_labels != 0 && num_jumplist_labels-- != 0
                 && (bank_num != MVM_OP_BANK_primitives || op_num != MVM_OP_goto)) {
             cleanup_all(tc, labels);
@@ -15,6 +15,27 @@ void * MVM_gc_allocate_nursery(MVMThreadContext *tc, size_t size) {
     if (tc->gc_status)
         MVM_gc_enter_from_interrupt(tc);
 
+    /* Objects too large for the size classes of the second generation are
+     * allocated straight into its large object space, so they are never
+     * copied. They take their size out of what is left of the nursery all
+     * the same, so that allocating them still leads to GC runs, and count
+     * towards the growth that leads to a full collection. */
+    if (size > MVM_GEN2_MAX_BIN_SIZE) {
+        size_t charge = MVM_GEN2_LARGE_REGION_SIZE(size);
+        if (charge > tc->nursery_tospace_size / 2)
+            charge = tc->nursery_tospace_size / 2;
+        while ((char *)tc->nursery_alloc + charge >= (char *)tc->nursery_alloc_limit)
+            MVM_gc_enter_from_allocator(tc);
+        tc->nursery_alloc_limit = (char *)tc->nursery_alloc_limit - charge;
+        MVM_atomic_add(&tc->instance->gc_promoted_bytes, MVM_GEN2_LARGE_REGION_SIZE(size));
+        allocated = MVM_gc_gen2_allocate_zeroed(tc, size);
+
+        /* In a concurrent marking cycle, what's new in gen2 is live. */
+        if (tc->instance->gc_marking)
+            MVM_gc_gen2_large_mark((MVMCollectable *)allocated);
+        return allocated;
+    }
+
     /* Guard against 0-byte allocation. */
     if (size > 0) {
         /* Do a GC run if this allocation won't fit in what we have
@@ -24,11 +45,8 @@ void * MVM_gc_allocate_nursery(MVMThreadContext *tc, size_t size) {
          * actually gets freed up. The next run will promote them to the
          * second generation. Note that this circumstance is exceptionally
          * unlikely in any non-contrived situation. */
-        while ((char *)tc->nursery_alloc + size >= (char *)tc->nursery_alloc_limit) {
-            if (size > MVM_NURSERY_SIZE)
-                MVM_panic(MVM_exitcode_gcalloc, "Attempt to allocate more than the maximum nursery size");
+        while ((char *)tc->nursery_alloc + size >= (char *)tc->nursery_alloc_limit)
             MVM_gc_enter_from_allocator(tc);
-        }
 
         /* Allocate (just bump the pointer). */
         allocated = tc->nursery_alloc;
@@ -6,6 +6,28 @@ MVMObject * MVM_gc_allocate_object(MVMThreadContext *tc, MVMSTable *st);
 void MVM_gc_allocate_gen2_default_set(MVMThreadContext *tc);
 void MVM_gc_allocate_gen2_default_clear(MVMThreadContext *tc);
 
+/* Allocates an instance of a type, leaving it in result. For REPRs with
+ * fixed_size set, this bumps the nursery pointer right here when there's
+ * room and no GC run was signalled, doing what MVM_gc_allocate_object would
+ * without the calls, the rooting or the write barrier (a new nursery object
+ * is never in gen2). Anything else goes to the REPR's allocate. */
+#define MVM_gc_allocate_object_fast(tc, type_st, result) \
+    { \
+        MVMSTable *_st = type_st; \
+        char *_a = (char *)(tc)->nursery_alloc; \
+        if (_st->REPR->fixed_size && _st->size && _st->size <= MVM_GEN2_MAX_BIN_SIZE \
+                && (tc)->allocate_in == MVMAllocate_Nursery && !(tc)->gc_status \
+                && _a + _st->size < (char *)(tc)->nursery_alloc_limit) { \
+            (tc)->nursery_alloc = _a + _st->size; \
+            result = (MVMObject *)_a; \
+            result->header.owner = (tc)->thread_id; \
+            result->st = _st; \
+        } \
+        else { \
+            result = _st->REPR->allocate(tc, _st); \
+        } \
+    }
+
 #define MVM_gc_allocate(tc, size) (tc->allocate_in == MVMAllocate_Nursery ? \
     MVM_gc_allocate_nursery(tc, size) : \
-    MVM_gc_gen2_allocate_zeroed(tc->gen2, size))
+    MVM_gc_gen2_allocate_zeroed(tc, size))
@@ -58,15 +58,31 @@ void MVM_gc_collect(MVMThreadContext *tc, MVMuint8 what_to_do, MVMuint8 gen) {
     /* If we're starting a run (as opposed to just coming back here to do a
      * little more work we got after we first thought we were done...) */
     if (what_to_do != MVMGCWhatToDo_InTray) {
+        /* Objects in gen2 pages not swept since the last full collection
+         * still carry its marks, so finish sweeping before we mark (or a
+         * concurrent marking cycle does). */
+        if (gen == MVMGCGenerations_Both || tc->instance->gc_marking)
+            MVM_gc_gen2_sweep_all(tc);
+
+        /* A full collection that defragments picks the pages to empty now,
+         * before anything of ours is marked. A remark doesn't, since the
+         * marking cycle it ends has marked objects in place. */
+        if (gen == MVMGCGenerations_Both && tc->instance->gc_defrag && !tc->instance->gc_remark)
+            MVM_gc_gen2_start_evacuation(tc);
+
         /* Swap fromspace and tospace. */
         void * fromspace = tc->nursery_tospace;
         void * tospace   = tc->nursery_fromspace;
-        tc->nursery_fromspace = fromspace;
-        tc->nursery_tospace   = tospace;
+        MVMuint32 fromspace_size = tc->nursery_tospace_size;
+        MVMuint32 tospace_size   = tc->nursery_fromspace_size;
+        tc->nursery_fromspace      = fromspace;
+        tc->nursery_tospace        = tospace;
+        tc->nursery_fromspace_size = fromspace_size;
+        tc->nursery_tospace_size   = tospace_size;
 
         /* Reset nursery allocation pointers to the new tospace. */
         tc->nursery_alloc       = tospace;
-        tc->nursery_alloc_limit = (char *)tc->nursery_alloc + MVM_NURSERY_SIZE;
+        tc->nursery_alloc_limit = (char *)tc->nursery_alloc + tospace_size;
 
         MVM_gc_worklist_add(tc, worklist, &tc->thread_obj);
         GCCOLL_LOG(tc, "Thread %d run %d : processing %d items from thread_obj\n", worklist->items);
@@ -81,6 +97,14 @@ void MVM_gc_collect(MVMThreadContext *tc, MVMuint8 what_to_do, MVMuint8 gen) {
             MVM_gc_root_add_instance_roots_to_worklist(tc, worklist);
             GCCOLL_LOG(tc, "Thread %d run %d : processing %d items from instance roots\n", worklist->items);
             process_worklist(tc, worklist, &wtp, gen);
+
+            /* Hand objects greyed by other threads than their owners in a
+             * concurrent marking cycle over to the owners. */
+            if (tc->instance->gc_marking || tc->instance->gc_remark) {
+                MVM_gc_concurrent_add_foreign_to_worklist(tc, worklist);
+                GCCOLL_LOG(tc, "Thread %d run %d : processing %d items from foreign grey objects\n", worklist->items);
+                process_worklist(tc, worklist, &wtp, gen);
+            }
         }
 
         /* Add per-thread state to worklist and process it. */
@@ -104,6 +128,13 @@ void MVM_gc_collect(MVMThreadContext *tc, MVMuint8 what_to_do, MVMuint8 gen) {
             process_worklist(tc, worklist, &wtp, gen);
         }
 
+        /* If this ends a concurrent marking cycle, trace what it left. */
+        if (tc->instance->gc_remark) {
+            MVM_gc_concurrent_add_grey_to_worklist(tc, worklist);
+            GCCOLL_LOG(tc, "Thread %d run %d : processing %d items from grey objects \n", worklist->items);
+            process_worklist(tc, worklist, &wtp, gen);
+        }
+
         /* Find roots in frames and process them. */
         if (tc->cur_frame) {
             MVM_gc_worklist_add_frame(tc, worklist, tc->cur_frame);
@@ -137,11 +168,18 @@ void MVM_gc_collect(MVMThreadContext *tc, MVMuint8 what_to_do, MVMuint8 gen) {
         pass_leftover_work(tc, &wtp);
         free(wtp.target_work);
     }
+}
 
-    /* If it was a full collection, some of the things in gen2 that we root
-     * due to point to gen1 objects may be dead. */
-    if (gen != MVMGCGenerations_Nursery)
-        MVM_gc_root_gen2_cleanup(tc);
+/* Works out the size of a collectable. */
+MVMuint32 MVM_gc_collectable_size(MVMCollectable *item) {
+    if (!(item->flags & (MVM_CF_TYPE_OBJECT | MVM_CF_STABLE)))
+        return ((MVMObject *)item)->st->size;
+    else if (item->flags & MVM_CF_TYPE_OBJECT)
+        return sizeof(MVMObject);
+    else if (item->flags & MVM_CF_STABLE)
+        return sizeof(MVMSTable);
+    MVM_panic(MVM_exitcode_gcnursery, "Internal error: impossible case encountered in GC sizing");
+    return 0;
 }
 
 /* Processes the current worklist. */
@@ -172,10 +210,28 @@ static void process_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist, Work
             continue;
 
         /* If it's in the second generation and we're only doing a nursery,
-         * collection, we have nothing to do. */
+         * collection, we have nothing to do, unless a concurrent marking
+         * cycle is in progress; then it's greyed by its owner. */
         item_gen2 = item->flags & MVM_CF_SECOND_GEN;
-        if (item_gen2 && gen == MVMGCGenerations_Nursery)
+        if (item_gen2 && gen == MVMGCGenerations_Nursery) {
+            if (tc->instance->gc_marking) {
+                if (item->owner != tc->thread_id)
+                    pass_work_item(tc, wtp, item_ptr);
+                else
+                    MVM_gc_concurrent_grey(tc, item);
+            }
             continue;
+        }
+
+        /* If it's in the second generation and owned by a different thread,
+         * its mark may be left over from the last full collection, if that
+         * thread did not sweep it yet, so only the owner can tell whether
+         * it was marked in this one. */
+        if (item_gen2 && item->owner != tc->thread_id) {
+            GCCOLL_LOG(tc, "Thread %d run %d : sending a handle %p to gen2 object %p to thread %d\n", item_ptr, item, item->owner);
+            pass_work_item(tc, wtp, item_ptr);
+            continue;
+        }
 
         /* If the item was already seen and copied, then it will have a
          * forwarding address already. Just update this pointer to the
@@ -208,11 +264,31 @@ static void process_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist, Work
 
         /* At this point, we didn't already see the object, which means we
          * need to take some action. Go on the generation... */
-        if (item_gen2) {
-            /* It's in the second generation. We'll just mark it, which is
-             * done by setting the forwarding pointer to the object itself,
-             * since we don't do moving. */
+        if (item->flags & MVM_CF_LARGE_OBJECT) {
+            /* It's in the large object space, which keeps the marks in a
+             * side table. If it was marked already, we're done. */
+            if (MVM_gc_gen2_large_mark(item))
+                continue;
             new_addr = item;
+        }
+        else if (item_gen2) {
+            /* It's in the second generation. Unless it's in a page being
+             * emptied, we'll just mark it, which is done by setting the
+             * forwarding pointer to the object itself. */
+            size = MVM_gc_collectable_size(item);
+            if (item->flags & MVM_CF_EVACUATE) {
+                /* Move it to another page, and leave a forwarding pointer
+                 * behind, as for a nursery object we copy. */
+                new_addr = (MVMCollectable *)MVM_gc_gen2_allocate(tc, size);
+                memcpy(new_addr, item, size);
+                new_addr->flags &= ~MVM_CF_EVACUATE;
+                new_addr->forwarder = new_addr;
+                GCCOLL_LOG(tc, "Thread %d run %d : evacuating %p to %p\n", item, new_addr);
+            }
+            else {
+                new_addr = item;
+            }
+            tc->gc_gen2_marked_bytes += size;
             if (GCCOLL_DEBUG) {
                 if (new_addr != item) {
                     GCCOLL_LOG(tc, "Thread %d run %d : updating handle %p from referent %p to %p\n", item_ptr, item, new_addr);
@@ -229,26 +305,23 @@ static void process_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist, Work
             }
             /* We've got a live object in the nursery; this means some kind of
              * copying is going to happen. Work out the size. */
-            if (!(item->flags & (MVM_CF_TYPE_OBJECT | MVM_CF_STABLE)))
-                size = ((MVMObject *)item)->st->size;
-            else if (item->flags & MVM_CF_TYPE_OBJECT)
-                size = sizeof(MVMObject);
-            else if (item->flags & MVM_CF_STABLE)
-                size = sizeof(MVMSTable);
-            else
-                MVM_panic(MVM_exitcode_gcnursery, "Internal error: impossible case encountered in GC sizing");
-
-            /* Did we see it in the nursery before? */
-            if (item->flags & MVM_CF_NURSERY_SEEN) {
+            size = MVM_gc_collectable_size(item);
+
+            /* Did we see it in the nursery before? (If the nursery just
+             * shrank, tospace may be too small to take all that survives
+             * this time; in that case, we promote the rest early.) */
+            if (item->flags & MVM_CF_NURSERY_SEEN
+                    || (char *)tc->nursery_alloc + size > (char *)tc->nursery_alloc_limit) {
                 /* Yes; we should move it to the second generation. Allocate
                  * space in the second generation. */
-                new_addr = MVM_gc_gen2_allocate(gen2, size);
+                new_addr = MVM_gc_gen2_allocate(tc, size);
+                tc->gc_promoted_bytes += size;
 
                 /* Copy the object to the second generation and mark it as
                  * living there. */
                 GCCOLL_LOG(tc, "Thread %d run %d : copying an object %p of size %d to gen2 %p\n", item, size, new_addr);
                 memcpy(new_addr, item, size);
-                new_addr->flags ^= MVM_CF_NURSERY_SEEN;
+                new_addr->flags &= ~MVM_CF_NURSERY_SEEN;
                 new_addr->flags |= MVM_CF_SECOND_GEN;
 
                 /* If it references frames or static frames, we need to keep
@@ -261,8 +334,10 @@ static void process_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist, Work
 
                 /* If we're going to sweep the second generation, also need
                  * to mark it as live. */
-                if (gen == MVMGCGenerations_Both)
+                if (gen == MVMGCGenerations_Both || tc->instance->gc_marking) {
                     new_addr->forwarder = new_addr;
+                    tc->gc_gen2_marked_bytes += size;
+                }
             }
             else {
                 /* No, so it will live in the nursery for another GC
@@ -410,8 +485,11 @@ static void push_work_to_thread_in_tray(MVMThreadContext *tc, MVMuint32 target,
         MVMGCPassedWork *orig = *target_tray;
         work->next = orig;
         if (apr_atomic_casptr((volatile void **)target_tray, work, orig) == orig)
-            return;
+            break;
     }
+
+    /* The thread collecting for the target may be waiting for work. */
+    MVM_gc_signal_progress(tc);
 }
 
 /* Adds work to list of items to pass over to another thread, and if we
@@ -491,6 +569,9 @@ static void add_in_tray_to_worklist(MVMThreadContext *tc, MVMGCWorklist *worklis
         head->completed = 1;
         head = next;
     }
+
+    /* The threads that passed the work may be waiting for it to be taken. */
+    MVM_gc_signal_progress(tc);
 }
 
 /* Some objects, having been copied, need no further attention. Others
@@ -542,93 +623,59 @@ void MVM_gc_collect_free_nursery_uncopied(MVMThreadContext *tc, void *limit) {
 
 /* Goes through the inter-generational roots and removes any that have been
 * determined dead. Should run just after gen2 GC has run but before building
-* the free list (which clears the marks). */
+* the free list (which clears the marks). The roots may be objects of other
+* threads, so every thread must be done with this before any of them builds
+* its free list. */
 void MVM_gc_collect_cleanup_gen2roots(MVMThreadContext *tc) {
     MVMCollectable **gen2roots = tc->gen2roots;
     MVMuint32        num_roots = tc->num_gen2roots;
     MVMuint32        ins_pos   = 0;
     MVMuint32        i;
     for (i = 0; i < num_roots; i++)
-        if (gen2roots[i]->forwarder)
-            gen2roots[ins_pos++] = gen2roots[i];
+        if ((gen2roots[ins_pos] = MVM_gc_gen2_survivor(gen2roots[i])))
+            ins_pos++;
     tc->num_gen2roots = ins_pos;
 }
 
-/* Goes through the unmarked objects in the second generation heap and builds
- * free lists out of them. Also does any required finalization. */
-void MVM_gc_collect_free_gen2_unmarked(MVMThreadContext *tc) {
-    /* Visit each of the size class bins. */
-    MVMGen2Allocator *gen2 = tc->gen2;
-    MVMuint32 bin, obj_size, page;
-    char ***freelist_insert_pos;
-    for (bin = 0; bin < MVM_GEN2_BINS; bin++) {
-        /* If we've nothing allocated in this size class, skip it. */
-        if (gen2->size_classes[bin].pages == NULL)
-            continue;
-
-        /* Calculate object size for this bin. */
-        obj_size = (bin + 1) << MVM_GEN2_BIN_BITS;
-
-        /* freelist_insert_pos is a pointer to a memory location that
-         * stores the address of the last traversed free list node (char **). */
-        /* Initialize freelist insertion position to free list head. */
-        freelist_insert_pos = &gen2->size_classes[bin].free_list;
-
-        /* Visit each page. */
-        for (page = 0; page < gen2->size_classes[bin].num_pages; page++) {
-            /* Visit all the objects, looking for dead ones and reset the
-             * mark for each of them. */
-            char *cur_ptr = gen2->size_classes[bin].pages[page];
-            char *end_ptr = page + 1 == gen2->size_classes[bin].num_pages
-                ? gen2->size_classes[bin].alloc_pos
-                : cur_ptr + obj_size * MVM_GEN2_PAGE_ITEMS;
-            char **last_insert_pos = NULL;
-            while (cur_ptr < end_ptr) {
-                MVMCollectable *col = (MVMCollectable *)cur_ptr;
-
-                /* Is this already a free list slot? If so, it becomes the
-                 * new free list insert position. */
-                if (*freelist_insert_pos == (char **)cur_ptr) {
-                    freelist_insert_pos = (char ***)cur_ptr;
-                }
-
-                /* Otherwise, it must be a collectable of some kind. Is it
-                 * live? */
-                else if (col->forwarder) {
-                    /* Yes; clear the mark. */
-                    col->forwarder = NULL;
-                }
-                else {
-                    GCCOLL_LOG(tc, "Thread %d run %d : collecting an object %p in the gen2\n", col);
-                    /* No, it's dead. Do any cleanup. */
-                    if (!(col->flags & (MVM_CF_TYPE_OBJECT | MVM_CF_STABLE))) {
-                        /* Object instance; call gc_free if needed. */
-                        MVMObject *obj = (MVMObject *)col;
-                        if (REPR(obj)->gc_free)
-                            REPR(obj)->gc_free(tc, obj);
-                    }
-                    else if (col->flags & MVM_CF_TYPE_OBJECT) {
-                        /* Type object; doesn't have anything extra that needs freeing. */
-                    }
-                    else if (col->flags & MVM_CF_STABLE) {
-                        MVM_panic(MVM_exitcode_gcnursery, "Can't free STables in gen2 GC yet");
-                    }
-                    else {
-                        printf("item flags: %d\n", col->flags);
-                        MVM_panic(MVM_exitcode_gcnursery, "Internal error: impossible case encountered in gen2 GC free");
-                    }
-
-                    /* Chain in to the free list. */
-                    *((char **)cur_ptr) = (char *)*freelist_insert_pos;
-                    *freelist_insert_pos = (char **)cur_ptr;
-
-                    /* Update the pointer to the insert position to point to us */
-                    freelist_insert_pos = (char ***)cur_ptr;
-                }
+/* Adapts the size of a thread's nursery after it was collected, going by
+ * how much of what was allocated in it survived; limit is where allocation
+ * had got to in what is now fromspace. Must be called after any uncopied
+ * objects in fromspace were freed, since a new size means a new fromspace.
+ * Collections that happen before the nursery is close to full (because
+ * another thread started them) say little, so are not taken into account. */
+void MVM_gc_collect_resize_nursery(MVMThreadContext *tc, void *limit) {
+    MVMuint64 used     = (char *)limit - (char *)tc->nursery_fromspace;
+    MVMuint64 survived = ((char *)tc->nursery_alloc - (char *)tc->nursery_tospace)
+        + tc->gc_promoted_bytes;
+    MVMuint32 max_size = tc->instance->gc_nursery_max_size;
+    MVMuint32 min_size = tc->instance->gc_nursery_size;
+
+    if (used * 2 >= tc->nursery_fromspace_size) {
+        if (survived * 100 < used * MVM_NURSERY_GROW_SURVIVAL && tc->nursery_size < max_size)
+            tc->nursery_size = tc->nursery_size * 2 < max_size ? tc->nursery_size * 2 : max_size;
+        else if (survived * 100 > used * MVM_NURSERY_SHRINK_SURVIVAL && tc->nursery_size > min_size)
+            tc->nursery_size = tc->nursery_size / 2 > min_size ? tc->nursery_size / 2 : min_size;
+    }
 
-                /* Move to the next object. */
-                cur_ptr += obj_size;
-            }
-        }
+    /* Fromspace holds nothing now, so it can take on the new size straight
+     * away; tospace will when it becomes fromspace after the next run. */
+    if (tc->nursery_fromspace_size != tc->nursery_size) {
+        GCCOLL_LOG(tc, "Thread %d run %d : resizing nursery to %d bytes\n", tc->nursery_size);
+        free(tc->nursery_fromspace);
+        tc->nursery_fromspace      = calloc(1, tc->nursery_size);
+        tc->nursery_fromspace_size = tc->nursery_size;
     }
 }
+
+/* Goes through the unmarked objects in the second generation heap and builds
+ * free lists out of them. Also does any required finalization. Objects in the
+ * size classes are left for lazy sweeping (see MVM_gc_gen2_start_sweep);
+ * large objects are freed straight away. Returns the number of bytes still
+ * in use by live objects. */
+MVMuint64 MVM_gc_collect_free_gen2_unmarked(MVMThreadContext *tc) {
+    MVMuint64 live = tc->gc_gen2_marked_bytes;
+    tc->gc_gen2_marked_bytes = 0;
+    MVM_gc_gen2_finish_evacuation(tc);
+    MVM_gc_gen2_start_sweep(tc);
+    return live + MVM_gc_gen2_large_sweep(tc);
+}
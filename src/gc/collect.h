@@ -1,11 +1,28 @@
 /* How big is the nursery area? Note that since it's semi-space copying, we
- * actually have double this amount allocated. Also it is per thread. */
-#define MVM_NURSERY_SIZE 2097152
+ * actually have double this amount allocated. Also it is per thread. This
+ * is the size a nursery starts out at; it may then grow, up to the maximum
+ * size, and shrink back again, depending on how much survives collections.
+ * Both can be set at startup (see MVM_vm_create_instance), but never to
+ * less than the minimum. */
+#define MVM_NURSERY_SIZE        2097152
+#define MVM_NURSERY_MAX_SIZE    33554432
+#define MVM_NURSERY_MIN_SIZE    65536
 
-/* How often do we collect the second generation? This is specified as the
- * number of nursery runs that happen per full collection. For example, if
- * this is set to 10 then every tenth collection will involve the full heap. */
-#define MVM_GC_GEN2_RATIO 10
+/* When less than this percentage of what was allocated in a nursery
+ * survives its collection, the cost of collecting it is mostly the fixed
+ * cost of scanning the roots, and doubling the nursery halves how often we
+ * pay that. When more than the second percentage survives, we halve it
+ * again, since a bigger nursery then mostly means longer pauses. */
+#define MVM_NURSERY_GROW_SURVIVAL   5
+#define MVM_NURSERY_SHRINK_SURVIVAL 40
+
+/* When do we collect the second generation? This is when the amount that
+ * was promoted into it since the last full collection exceeds the given
+ * percentage of what was alive in it after that collection, or the given
+ * minimum, whichever is larger. For example, if the percentage is 50 then
+ * a heap of 100MB is collected in full after 50MB more was promoted. */
+#define MVM_GC_GEN2_GROWTH      50
+#define MVM_GC_GEN2_MIN_GROWTH  8388608
 
 /* What things should be processed in this GC run? */
 typedef enum {
@@ -50,5 +67,7 @@ struct MVMGCPassedWork {
 void MVM_gc_collect(MVMThreadContext *tc, MVMuint8 what_to_do, MVMuint8 gen);
 void MVM_gc_collect_free_nursery_uncopied(MVMThreadContext *tc, void *limit);
 void MVM_gc_collect_cleanup_gen2roots(MVMThreadContext *tc);
-void MVM_gc_collect_free_gen2_unmarked(MVMThreadContext *tc);
+void MVM_gc_collect_resize_nursery(MVMThreadContext *tc, void *limit);
+MVMuint64 MVM_gc_collect_free_gen2_unmarked(MVMThreadContext *tc);
 void MVM_gc_mark_collectable(MVMThreadContext *tc, MVMGCWorklist *worklist, MVMCollectable *item);
+MVMuint32 MVM_gc_collectable_size(MVMCollectable *item);
@@ -0,0 +1,168 @@
+#include "moarvm.h"
+
+/* Concurrent marking of the second generation. Rather than marking all of
+ * gen2 in one full collection, with every thread stopped for the whole of
+ * it, a marking cycle can be spread out over the GC runs that happen while
+ * the program goes on running:
+ *
+ * - The cycle starts at a nursery collection. Every gen2 object that this
+ *   (and each nursery collection after it in the cycle) finds referenced
+ *   from the roots or the nursery is greyed: marked, and put on its owner's
+ *   list of objects whose references still need tracing.
+ * - After each GC run, every thread traces some of its grey objects,
+ *   greying the gen2 objects they reference in turn. Objects are only ever
+ *   traced by the thread that owns them, since that's the only one that
+ *   may change them (and, for arrays and hashes, reallocate where their
+ *   references are kept) while the others run. Objects owned by another
+ *   thread are handed over to it at the next GC run.
+ * - Objects that are promoted or allocated into gen2 during the cycle are
+ *   marked as they get there. A reference to a gen2 object that is stored
+ *   into a gen2 object is greyed by the write barrier, so that a traced
+ *   object can't come to hold the only reference to one that isn't.
+ * - Once there is nothing left to trace, the cycle is ended by a remark:
+ *   a full collection, with the world stopped, which only has to trace
+ *   what the marking in slices didn't get to, what is reachable from the
+ *   roots and the nursery, and the marked gen2 roots (since they may point
+ *   into the nursery, or to frames, whose registers are not write barriered).
+ *   Sweeping then goes as after any full collection.
+ */
+
+/* Adds an object to the list of those greyed by threads other than their
+ * owners. */
+static void add_foreign(MVMThreadContext *tc, MVMCollectable *item) {
+    MVMInstance *i = tc->instance;
+    if (apr_thread_mutex_lock(i->mutex_gc_foreign_grey) != APR_SUCCESS)
+        MVM_panic(MVM_exitcode_gcorch, "Unable to lock GC foreign grey objects");
+    if (i->num_foreign_grey == i->alloc_foreign_grey) {
+        i->alloc_foreign_grey = i->alloc_foreign_grey ? i->alloc_foreign_grey * 2 : 64;
+        i->gc_foreign_grey = realloc(i->gc_foreign_grey,
+            i->alloc_foreign_grey * sizeof(MVMCollectable *));
+    }
+    i->gc_foreign_grey[i->num_foreign_grey++] = item;
+    MVM_atomic_incr(&i->gc_grey_pending);
+    if (apr_thread_mutex_unlock(i->mutex_gc_foreign_grey) != APR_SUCCESS)
+        MVM_panic(MVM_exitcode_gcorch, "Unable to unlock GC foreign grey objects");
+}
+
+/* Greys a gen2 object, unless it was marked already. If it's owned by some
+ * other thread, it's left for that thread to do. */
+void MVM_gc_concurrent_grey(MVMThreadContext *tc, MVMCollectable *item) {
+    if (item->owner != tc->thread_id) {
+        add_foreign(tc, item);
+        return;
+    }
+
+    if (item->flags & MVM_CF_LARGE_OBJECT) {
+        if (MVM_gc_gen2_large_mark(item))
+            return;
+    }
+    else {
+        if (item->forwarder)
+            return;
+        item->forwarder = item;
+        tc->gc_gen2_marked_bytes += MVM_gc_collectable_size(item);
+    }
+
+    if (tc->num_gc_grey == tc->alloc_gc_grey) {
+        tc->alloc_gc_grey = tc->alloc_gc_grey ? tc->alloc_gc_grey * 2 : 256;
+        tc->gc_grey = realloc(tc->gc_grey, tc->alloc_gc_grey * sizeof(MVMCollectable *));
+    }
+    tc->gc_grey[tc->num_gc_grey++] = item;
+    MVM_atomic_incr(&tc->instance->gc_grey_pending);
+}
+
+/* Traces up to the given number of our grey objects, greying the gen2
+ * objects they reference. References to nursery objects are left alone:
+ * an object holding one is a gen2 root, so the nursery collections and the
+ * remark see to them. Likewise, frames are left for the remark. Returns
+ * the number of grey objects still left. */
+MVMuint32 MVM_gc_concurrent_mark_some(MVMThreadContext *tc, MVMuint32 max_objects) {
+    MVMGCWorklist   *worklist;
+    MVMCollectable **item_ptr;
+    MVMuint32        traced = 0;
+
+    if (!tc->num_gc_grey)
+        return 0;
+
+    worklist = MVM_gc_worklist_create(tc);
+    while (tc->num_gc_grey && traced < max_objects) {
+        MVM_gc_mark_collectable(tc, worklist, tc->gc_grey[--tc->num_gc_grey]);
+        worklist->frames = 0;
+        while ((item_ptr = MVM_gc_worklist_get(tc, worklist))) {
+            MVMCollectable *item = *item_ptr;
+            if (item && (item->flags & MVM_CF_SECOND_GEN))
+                MVM_gc_concurrent_grey(tc, item);
+        }
+        traced++;
+    }
+    MVM_gc_worklist_destroy(tc, worklist);
+
+    MVM_atomic_add(&tc->instance->gc_grey_pending, -(AO_t)traced);
+    return tc->num_gc_grey;
+}
+
+/* Takes the objects greyed by threads other than their owners, and adds
+ * them to the worklist, so the collection passes them on to their owners.
+ * Only one thread does this in a run. The list is freed once the run is
+ * over, since the worklist items point into it. */
+void MVM_gc_concurrent_add_foreign_to_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist) {
+    MVMInstance *i = tc->instance;
+    MVMuint32 num, k;
+
+    if (apr_thread_mutex_lock(i->mutex_gc_foreign_grey) != APR_SUCCESS)
+        MVM_panic(MVM_exitcode_gcorch, "Unable to lock GC foreign grey objects");
+    tc->gc_foreign_taken  = i->gc_foreign_grey;
+    num                   = i->num_foreign_grey;
+    i->gc_foreign_grey    = NULL;
+    i->num_foreign_grey   = 0;
+    i->alloc_foreign_grey = 0;
+    if (apr_thread_mutex_unlock(i->mutex_gc_foreign_grey) != APR_SUCCESS)
+        MVM_panic(MVM_exitcode_gcorch, "Unable to unlock GC foreign grey objects");
+
+    for (k = 0; k < num; k++)
+        MVM_gc_worklist_add(tc, worklist, &tc->gc_foreign_taken[k]);
+    MVM_atomic_add(&i->gc_grey_pending, -(AO_t)num);
+}
+
+/* Frees the foreign grey objects taken in a run, once it is over. */
+void MVM_gc_concurrent_free_foreign(MVMThreadContext *tc) {
+    free(tc->gc_foreign_taken);
+    tc->gc_foreign_taken = NULL;
+}
+
+/* Adds what the remark that ends a marking cycle must trace for a thread,
+ * besides its roots and nursery, to the worklist: the references of its
+ * grey objects and of its marked gen2 roots. */
+void MVM_gc_concurrent_add_grey_to_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist) {
+    MVMuint32 k;
+
+    for (k = 0; k < tc->num_gc_grey; k++)
+        MVM_gc_mark_collectable(tc, worklist, tc->gc_grey[k]);
+    MVM_atomic_add(&tc->instance->gc_grey_pending, -(AO_t)tc->num_gc_grey);
+    tc->num_gc_grey = 0;
+
+    /* Other threads may still be marking their large objects as we look,
+     * so those are traced either way. */
+    for (k = 0; k < tc->num_gen2roots; k++) {
+        MVMCollectable *root = tc->gen2roots[k];
+        if (((root->flags & MVM_CF_LARGE_OBJECT) && root->owner != tc->thread_id)
+                || MVM_gc_gen2_is_marked(root))
+            MVM_gc_mark_collectable(tc, worklist, root);
+    }
+}
+
+/* Hands the grey objects of a thread that is going away to the thread that
+ * takes on its second generation. */
+void MVM_gc_concurrent_transfer(MVMThreadContext *src, MVMThreadContext *dest) {
+    MVMuint32 k;
+    for (k = 0; k < src->num_gc_grey; k++) {
+        if (dest->num_gc_grey == dest->alloc_gc_grey) {
+            dest->alloc_gc_grey = dest->alloc_gc_grey ? dest->alloc_gc_grey * 2 : 256;
+            dest->gc_grey = realloc(dest->gc_grey, dest->alloc_gc_grey * sizeof(MVMCollectable *));
+        }
+        dest->gc_grey[dest->num_gc_grey++] = src->gc_grey[k];
+    }
+    src->num_gc_grey = 0;
+    dest->gc_gen2_marked_bytes += src->gc_gen2_marked_bytes;
+    src->gc_gen2_marked_bytes = 0;
+}
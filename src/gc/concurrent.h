@@ -0,0 +1,12 @@
+/* While a concurrent marking cycle is in progress, a thread traces one of
+ * its grey objects after each GC run for every this many bytes its nursery
+ * is in size, so the marking keeps pace with what the nursery promotes. */
+#define MVM_GC_MARK_SLICE_RATE 16
+
+/* Functions. */
+void MVM_gc_concurrent_grey(MVMThreadContext *tc, MVMCollectable *item);
+MVMuint32 MVM_gc_concurrent_mark_some(MVMThreadContext *tc, MVMuint32 max_objects);
+void MVM_gc_concurrent_add_foreign_to_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist);
+void MVM_gc_concurrent_free_foreign(MVMThreadContext *tc);
+void MVM_gc_concurrent_add_grey_to_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist);
+void MVM_gc_concurrent_transfer(MVMThreadContext *src, MVMThreadContext *dest);
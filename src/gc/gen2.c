@@ -1,5 +1,14 @@
 #include "moarvm.h"
 
+#ifdef _WIN32
+#  include <windows.h>
+#else
+#  include <sys/mman.h>
+#  ifndef MAP_ANON
+#    define MAP_ANON MAP_ANONYMOUS
+#  endif
+#endif
+
 /* Creates a new second generation allocator. */
 MVMGen2Allocator * MVM_gc_gen2_create(MVMInstance *i) {
     /* Create allocator data structure. */
@@ -9,14 +18,102 @@ MVMGen2Allocator * MVM_gc_gen2_create(MVMInstance *i) {
     al->size_classes = malloc(sizeof(MVMGen2SizeClass) * MVM_GEN2_BINS);
     memset(al->size_classes, 0, sizeof(MVMGen2SizeClass) * MVM_GEN2_BINS);
 
-    /* Set up overflows area. */
-    al->alloc_overflows = MVM_GEN2_OVERFLOWS;
-    al->num_overflows = 0;
-    al->overflows = malloc(al->alloc_overflows * sizeof(MVMCollectable *));
+    /* Set up the large object space. */
+    al->large = malloc(sizeof(MVMGen2LargeObjects));
+    al->large->alloc_objects     = MVM_GEN2_LARGE_OBJECTS;
+    al->large->num_objects       = 0;
+    al->large->objects           = malloc(al->large->alloc_objects * sizeof(MVMCollectable *));
+    al->large->free_regions      = malloc(MVM_GEN2_LARGE_FREE_REGIONS * sizeof(MVMGen2LargeRegion));
+    al->large->num_free_regions  = 0;
 
     return al;
 }
 
+/* Maps a new region for a large object. Its memory is zeroed. */
+static void * map_region(MVMuint32 size) {
+#ifdef _WIN32
+    void *region = VirtualAlloc(NULL, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    if (!region)
+        MVM_panic(MVM_exitcode_gcalloc, "Could not map %u bytes for a large object", size);
+#else
+    void *region = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+    if (region == MAP_FAILED)
+        MVM_panic(MVM_exitcode_gcalloc, "Could not map %u bytes for a large object", size);
+#endif
+    return region;
+}
+
+/* Unmaps a large object region. */
+static void unmap_region(void *region, MVMuint32 size) {
+#ifdef _WIN32
+    VirtualFree(region, 0, MEM_RELEASE);
+#else
+    munmap(region, size);
+#endif
+}
+
+/* Gives the pages of a large object region back to the operating system,
+ * keeping the address space. */
+static void release_region(void *region, MVMuint32 size) {
+#ifdef _WIN32
+    VirtualFree(region, size, MEM_DECOMMIT);
+#else
+    madvise(region, size, MADV_DONTNEED);
+#endif
+}
+
+/* Makes a released region usable again. It reads as zeroes afterwards. */
+static void reuse_region(void *region, MVMuint32 size) {
+#ifdef _WIN32
+    if (!VirtualAlloc(region, size, MEM_COMMIT, PAGE_READWRITE))
+        MVM_panic(MVM_exitcode_gcalloc, "Could not map %u bytes for a large object", size);
+#else
+    /* Nothing to do; touching the pages brings them back, zeroed. */
+#endif
+}
+
+/* Adds a large object to the large object tables. */
+static void large_add(MVMGen2LargeObjects *large, MVMCollectable *col) {
+    if (large->num_objects == large->alloc_objects) {
+        large->alloc_objects *= 2;
+        large->objects = realloc(large->objects, large->alloc_objects * sizeof(MVMCollectable *));
+    }
+    large->objects[large->num_objects++] = col;
+}
+
+/* Allocates a large object in a region of its own, reusing the region of a
+ * dead one if there is one of a fitting size. The memory is zeroed. */
+static void * large_allocate(MVMGen2Allocator *al, MVMuint32 size) {
+    MVMGen2LargeObjects *large = al->large;
+    MVMuint32 region_size = MVM_GEN2_LARGE_REGION_SIZE(size);
+    MVMGen2LargeHeader *header = NULL;
+    MVMuint32 i = large->num_free_regions;
+
+    /* Look for a free region that is big enough, but not so big that much
+     * of it would go to waste, starting with those freed last, since they
+     * are the most likely to still be resident. */
+    while (i--) {
+        MVMGen2LargeRegion *free_region = &large->free_regions[i];
+        if (free_region->size >= region_size && free_region->size / 2 < region_size) {
+            header      = free_region->header;
+            region_size = free_region->size;
+            if (free_region->released)
+                reuse_region(header, region_size);
+            else
+                memset(header, 0, sizeof(MVMGen2LargeHeader) + size);
+            *free_region = large->free_regions[--large->num_free_regions];
+            break;
+        }
+    }
+    if (!header)
+        header = (MVMGen2LargeHeader *)map_region(region_size);
+
+    header->region_size = region_size;
+    large_add(large, (MVMCollectable *)(header + 1));
+
+    return header + 1;
+}
+
 /* Sets up a size class bin in the second generation. */
 static void setup_bin(MVMGen2Allocator *al, MVMuint32 bin) {
     /* Work out page size we want. */
@@ -52,10 +149,243 @@ static void add_page(MVMGen2Allocator *al, MVMuint32 bin) {
     al->size_classes[bin].alloc_limit = al->size_classes[bin].alloc_pos + page_size;
 }
 
+/* Does any cleanup needed for a dead object in a size class. */
+static void free_dead(MVMThreadContext *tc, MVMCollectable *col) {
+    if (!(col->flags & (MVM_CF_TYPE_OBJECT | MVM_CF_STABLE))) {
+        /* Object instance; call gc_free if needed. */
+        MVMObject *obj = (MVMObject *)col;
+        if (REPR(obj)->gc_free)
+            REPR(obj)->gc_free(tc, obj);
+    }
+    else if (col->flags & MVM_CF_TYPE_OBJECT) {
+        /* Type object; doesn't have anything extra that needs freeing. */
+    }
+    else if (col->flags & MVM_CF_STABLE) {
+        MVM_panic(MVM_exitcode_gcnursery, "Can't free STables in gen2 GC yet");
+    }
+    else {
+        printf("item flags: %d\n", col->flags);
+        MVM_panic(MVM_exitcode_gcnursery, "Internal error: impossible case encountered in gen2 GC free");
+    }
+}
+
+/* Sweeps the next page of a size class that is still to be swept: dead
+ * objects are cleaned up and, along with the slots that were free already,
+ * go on the free list, and the marks of live objects are cleared. */
+static void sweep_page(MVMThreadContext *tc, MVMGen2SizeClass *sc, MVMuint32 obj_size) {
+    char *cur_ptr = sc->pages[sc->cur_sweep_page];
+    char *end_ptr = sc->cur_sweep_page + 1 == sc->num_sweep_pages
+        ? sc->sweep_end
+        : cur_ptr + obj_size * MVM_GEN2_PAGE_ITEMS;
+    sc->cur_sweep_page++;
+    for ( ; cur_ptr < end_ptr; cur_ptr += obj_size) {
+        MVMCollectable *col = (MVMCollectable *)cur_ptr;
+        if (!MVM_GEN2_IS_FREE(cur_ptr)) {
+            if (col->forwarder) {
+                /* Live; clear the mark. */
+                col->forwarder = NULL;
+                continue;
+            }
+            free_dead(tc, col);
+        }
+        ((char **)cur_ptr)[0] = (char *)sc->free_list;
+        ((void **)cur_ptr)[1] = MVM_GEN2_FREE_MARKER;
+        sc->free_list = (char **)cur_ptr;
+    }
+}
+
+/* Called at the end of a full collection, after marking. Rather than sweep
+ * the size classes now, we queue all of their pages as still to be swept,
+ * and sweep them as free slots are needed, or as there is time. Free slots
+ * are found again by the sweep, so we forget the free lists until then. */
+void MVM_gc_gen2_start_sweep(MVMThreadContext *tc) {
+    MVMGen2Allocator *al = tc->gen2;
+    MVMuint32 bin;
+
+    /* Anything left over from the last time must be swept first. */
+    MVM_gc_gen2_sweep_all(tc);
+
+    for (bin = 0; bin < MVM_GEN2_BINS; bin++) {
+        MVMGen2SizeClass *sc = &al->size_classes[bin];
+        if (sc->pages == NULL)
+            continue;
+        sc->free_list       = NULL;
+        sc->cur_sweep_page  = 0;
+        sc->num_sweep_pages = sc->num_pages;
+        sc->sweep_end       = sc->alloc_pos;
+    }
+}
+
+/* Sweeps up to the given number of pages that are still to be swept, and
+ * returns how many it swept. */
+MVMuint32 MVM_gc_gen2_sweep_some(MVMThreadContext *tc, MVMuint32 max_pages) {
+    MVMGen2Allocator *al = tc->gen2;
+    MVMuint32 bin, swept = 0;
+    for (bin = 0; bin < MVM_GEN2_BINS && swept < max_pages; bin++) {
+        MVMGen2SizeClass *sc = &al->size_classes[bin];
+        while (sc->cur_sweep_page < sc->num_sweep_pages && swept < max_pages) {
+            sweep_page(tc, sc, (bin + 1) << MVM_GEN2_BIN_BITS);
+            swept++;
+        }
+    }
+    return swept;
+}
+
+/* Sweeps all pages that are still to be swept. This must be done before
+ * marking starts in a full collection, since the objects in them still
+ * carry the marks of the last one. */
+void MVM_gc_gen2_sweep_all(MVMThreadContext *tc) {
+    MVM_gc_gen2_sweep_some(tc, (MVMuint32)-1);
+}
+
+/* A page that may be emptied, and the number of objects in it. */
+typedef struct {
+    MVMuint32 page;
+    MVMuint32 objects;
+} EvacCandidate;
+
+/* Sorts the pages that may be emptied, emptiest first. */
+static int compare_candidates(const void *a, const void *b) {
+    const EvacCandidate *ca = (const EvacCandidate *)a;
+    const EvacCandidate *cb = (const EvacCandidate *)b;
+    if (ca->objects != cb->objects)
+        return ca->objects < cb->objects ? -1 : 1;
+    return ca->page < cb->page ? -1 : ca->page > cb->page;
+}
+
+/* Chooses the pages of a size class to empty in a full collection that
+ * defragments, which are the emptiest ones, as long as what's in them fits
+ * into the free slots of the rest. Returns how many were chosen, having
+ * flagged them in the evacuate array. */
+static MVMuint32 choose_evac_pages(MVMGen2SizeClass *sc, MVMuint32 obj_size, MVMuint8 *evacuate) {
+    MVMuint32      num_candidates = sc->num_pages - 1;
+    EvacCandidate *candidates     = malloc(num_candidates * sizeof(EvacCandidate));
+    MVMuint64      free_slots     = (sc->alloc_limit - sc->alloc_pos) / obj_size;
+    MVMuint64      moved          = 0;
+    MVMuint32      chosen         = 0;
+    MVMuint32      i;
+
+    /* Count the objects in each page, but the one we're allocating in. A
+     * page with an STable in stays, since objects that die later still
+     * point to their STable when they are freed; so does one with a type
+     * object in, since C code freely holds on to those over allocations. */
+    for (i = 0; i < num_candidates; i++) {
+        char *cur_ptr = sc->pages[i];
+        char *end_ptr = cur_ptr + obj_size * MVM_GEN2_PAGE_ITEMS;
+        candidates[i].page    = i;
+        candidates[i].objects = 0;
+        for ( ; cur_ptr < end_ptr; cur_ptr += obj_size) {
+            if (MVM_GEN2_IS_FREE(cur_ptr))
+                continue;
+            if (((MVMCollectable *)cur_ptr)->flags & (MVM_CF_STABLE | MVM_CF_TYPE_OBJECT)) {
+                candidates[i].objects = MVM_GEN2_PAGE_ITEMS;
+                break;
+            }
+            candidates[i].objects++;
+        }
+        free_slots += MVM_GEN2_PAGE_ITEMS - candidates[i].objects;
+    }
+
+    /* Emptying a page takes as many free slots elsewhere as it has objects,
+     * and its own free slots go away with it. */
+    qsort(candidates, num_candidates, sizeof(EvacCandidate), compare_candidates);
+    for (i = 0; i < num_candidates; i++) {
+        MVMuint32 objects = candidates[i].objects;
+        if (objects * 100 > MVM_GEN2_PAGE_ITEMS * MVM_GEN2_EVAC_OCCUPANCY)
+            break;
+        if (moved + objects > free_slots - (MVM_GEN2_PAGE_ITEMS - objects))
+            break;
+        free_slots -= MVM_GEN2_PAGE_ITEMS - objects;
+        moved      += objects;
+        evacuate[candidates[i].page] = 1;
+        chosen++;
+    }
+
+    free(candidates);
+    return chosen;
+}
+
+/* Called at the start of a full collection that defragments, after all was
+ * swept. Takes the pages chosen to be emptied out of their size classes,
+ * so nothing is allocated in them, and flags the objects in them, so those
+ * that are found alive are moved. The free lists are made again from the
+ * pages that stay. */
+void MVM_gc_gen2_start_evacuation(MVMThreadContext *tc) {
+    MVMGen2Allocator *al = tc->gen2;
+    MVMuint32 bin;
+
+    for (bin = 0; bin < MVM_GEN2_BINS; bin++) {
+        MVMGen2SizeClass *sc = &al->size_classes[bin];
+        MVMuint32 obj_size = (bin + 1) << MVM_GEN2_BIN_BITS;
+        MVMuint32 page, num_kept = 0;
+        MVMuint8 *evacuate;
+
+        if (sc->num_pages < 2)
+            continue;
+        evacuate = calloc(sc->num_pages, 1);
+        if (!choose_evac_pages(sc, obj_size, evacuate)) {
+            free(evacuate);
+            continue;
+        }
+
+        sc->free_list = NULL;
+        for (page = 0; page < sc->num_pages; page++) {
+            char *cur_ptr = sc->pages[page];
+            char *end_ptr = page + 1 == sc->num_pages
+                ? sc->alloc_pos
+                : cur_ptr + obj_size * MVM_GEN2_PAGE_ITEMS;
+            if (evacuate[page]) {
+                for ( ; cur_ptr < end_ptr; cur_ptr += obj_size)
+                    if (!MVM_GEN2_IS_FREE(cur_ptr))
+                        ((MVMCollectable *)cur_ptr)->flags |= MVM_CF_EVACUATE;
+                sc->evac_pages = realloc(sc->evac_pages,
+                    (sc->num_evac_pages + 1) * sizeof(char *));
+                sc->evac_pages[sc->num_evac_pages++] = sc->pages[page];
+            }
+            else {
+                for ( ; cur_ptr < end_ptr; cur_ptr += obj_size) {
+                    if (MVM_GEN2_IS_FREE(cur_ptr)) {
+                        ((char **)cur_ptr)[0] = (char *)sc->free_list;
+                        sc->free_list = (char **)cur_ptr;
+                    }
+                }
+                sc->pages[num_kept++] = sc->pages[page];
+            }
+        }
+        sc->num_pages = num_kept;
+        free(evacuate);
+    }
+}
+
+/* Called at the end of a full collection that defragments, before the
+ * sweep is started. The objects left in the pages that were emptied are
+ * dead (those alive were moved), so are cleaned up, and the pages freed. */
+void MVM_gc_gen2_finish_evacuation(MVMThreadContext *tc) {
+    MVMGen2Allocator *al = tc->gen2;
+    MVMuint32 bin, page;
+
+    for (bin = 0; bin < MVM_GEN2_BINS; bin++) {
+        MVMGen2SizeClass *sc = &al->size_classes[bin];
+        MVMuint32 obj_size = (bin + 1) << MVM_GEN2_BIN_BITS;
+        for (page = 0; page < sc->num_evac_pages; page++) {
+            char *cur_ptr = sc->evac_pages[page];
+            char *end_ptr = cur_ptr + obj_size * MVM_GEN2_PAGE_ITEMS;
+            for ( ; cur_ptr < end_ptr; cur_ptr += obj_size)
+                if (!MVM_GEN2_IS_FREE(cur_ptr) && !((MVMCollectable *)cur_ptr)->forwarder)
+                    free_dead(tc, (MVMCollectable *)cur_ptr);
+            free(sc->evac_pages[page]);
+        }
+        free(sc->evac_pages);
+        sc->evac_pages     = NULL;
+        sc->num_evac_pages = 0;
+    }
+}
+
 /* Allocates space using the second generation allocator and returns
  * a pointer to the allocated space. Does not zero the space or set
  * it up in any way. */
-void * MVM_gc_gen2_allocate(MVMGen2Allocator *al, MVMuint32 size) {
+void * MVM_gc_gen2_allocate(MVMThreadContext *tc, MVMuint32 size) {
+    MVMGen2Allocator *al = tc->gen2;
     void *result;
 
     /* Determine the bin. If we hit a bin exactly then it's off-by-one,
@@ -71,6 +401,13 @@ void * MVM_gc_gen2_allocate(MVMGen2Allocator *al, MVMuint32 size) {
         if (al->size_classes[bin].pages == NULL)
             setup_bin(al, bin);
 
+        /* If the free list is empty and the current page is full, sweep
+         * pages that are still to be swept until that gives us some. */
+        while (!al->size_classes[bin].free_list
+                && al->size_classes[bin].alloc_pos == al->size_classes[bin].alloc_limit
+                && al->size_classes[bin].cur_sweep_page < al->size_classes[bin].num_sweep_pages)
+            sweep_page(tc, &al->size_classes[bin], (bin + 1) << MVM_GEN2_BIN_BITS);
+
         /* If there's a free list entry, use that. */
         if (al->size_classes[bin].free_list) {
             result = (void *)al->size_classes[bin].free_list;
@@ -87,16 +424,8 @@ void * MVM_gc_gen2_allocate(MVMGen2Allocator *al, MVMuint32 size) {
         }
     }
     else {
-        /* We're beyond the size class bins, so resort to malloc. */
-        result = malloc(size);
-
-        /* Add to overflows list. */
-        if (al->num_overflows == al->alloc_overflows) {
-            al->alloc_overflows *= 2;
-            al->overflows = realloc(al->overflows,
-                al->alloc_overflows * sizeof(MVMCollectable *));
-        }
-        al->overflows[al->num_overflows++] = result;
+        /* We're beyond the size class bins, so it's a large object. */
+        result = large_allocate(al, size);
     }
 
     return result;
@@ -105,26 +434,119 @@ void * MVM_gc_gen2_allocate(MVMGen2Allocator *al, MVMuint32 size) {
 /* Allocates space using the second generation allocator and returns
  * a pointer to the allocated space. Promises the memory will be
  * zeroed, except that the MVMCollectable gen 2 flag will get set. */
-void * MVM_gc_gen2_allocate_zeroed(MVMGen2Allocator *al, MVMuint32 size) {
-    void *a = MVM_gc_gen2_allocate(al, size);
-    memset(a, 0, size);
-    ((MVMCollectable *)a)->flags = MVM_CF_SECOND_GEN;
+void * MVM_gc_gen2_allocate_zeroed(MVMThreadContext *tc, MVMuint32 size) {
+    void *a = MVM_gc_gen2_allocate(tc, size);
+    if (size > MVM_GEN2_MAX_BIN_SIZE) {
+        /* Large objects come zeroed already. */
+        ((MVMCollectable *)a)->flags = MVM_CF_SECOND_GEN | MVM_CF_LARGE_OBJECT;
+    }
+    else {
+        memset(a, 0, size);
+        ((MVMCollectable *)a)->flags = MVM_CF_SECOND_GEN;
+    }
     return a;
 }
 
+/* Marks a large object as live in a full collection, returning whether it
+ * was marked already. Must be called by the thread that owns it. */
+MVMuint32 MVM_gc_gen2_large_mark(MVMCollectable *c) {
+    MVMGen2LargeHeader *header = MVM_GEN2_LARGE_HEADER(c);
+    MVMuint32 was_marked = header->marked;
+    header->marked = 1;
+    return was_marked;
+}
+
+/* Tells whether an object in the second generation was marked as live in a
+ * full collection, by whichever means it was. Any thread may ask. */
+MVMuint32 MVM_gc_gen2_is_marked(MVMCollectable *c) {
+    if (c->flags & MVM_CF_LARGE_OBJECT)
+        return MVM_GEN2_LARGE_HEADER(c)->marked;
+    return c->forwarder != NULL;
+}
+
+/* Gives where a gen2 object lives after the marking of a full collection:
+ * where it was moved to if it was evacuated, else where it was, or NULL if
+ * it was not marked. */
+MVMCollectable * MVM_gc_gen2_survivor(MVMCollectable *c) {
+    if (c->flags & MVM_CF_LARGE_OBJECT)
+        return MVM_GEN2_LARGE_HEADER(c)->marked ? c : NULL;
+    return c->forwarder;
+}
+
+/* Frees the large objects that were not marked in a full collection, and
+ * clears the marks of the rest. The regions of the dead are kept (up to a
+ * limit) for reuse, but most of their pages are given back to the operating
+ * system. Returns the number of bytes taken up by live large objects. Since
+ * other threads look at the marks when cleaning up their gen2 roots, they
+ * must all have done so first. */
+MVMuint64 MVM_gc_gen2_large_sweep(MVMThreadContext *tc) {
+    MVMGen2LargeObjects *large = tc->gen2->large;
+    MVMuint32 i, survivors = 0;
+    MVMuint64 live = 0, resident = 0;
+
+    for (i = 0; i < large->num_objects; i++) {
+        MVMCollectable     *col    = large->objects[i];
+        MVMGen2LargeHeader *header = MVM_GEN2_LARGE_HEADER(col);
+        if (header->marked) {
+            /* Live; clear the mark, and close up the tables. */
+            header->marked = 0;
+            large->objects[survivors++] = col;
+            live += header->region_size;
+        }
+        else {
+            /* Dead; clean it up, and free its region. */
+            MVMuint32 region_size = header->region_size;
+            free_dead(tc, col);
+            if (large->num_free_regions < MVM_GEN2_LARGE_FREE_REGIONS) {
+                MVMGen2LargeRegion *free_region = &large->free_regions[large->num_free_regions++];
+                free_region->header   = header;
+                free_region->size     = region_size;
+                free_region->released = 0;
+            }
+            else {
+                unmap_region(header, region_size);
+            }
+        }
+    }
+    large->num_objects = survivors;
+
+    /* Give the pages of free regions back to the operating system, except
+     * for those of the most recently freed, up to a limit. */
+    i = large->num_free_regions;
+    while (i--) {
+        MVMGen2LargeRegion *free_region = &large->free_regions[i];
+        if (free_region->released)
+            continue;
+        if (resident + free_region->size <= MVM_GEN2_LARGE_RESIDENT) {
+            resident += free_region->size;
+        }
+        else {
+            release_region(free_region->header, free_region->size);
+            free_region->released = 1;
+        }
+    }
+
+    return live;
+}
+
 /* Frees all memory associated with the second generation. */
 void MVM_gc_gen2_destroy(MVMInstance *i, MVMGen2Allocator *al) {
     /* Remove all pages. */
     /* Usually the GC transfers all pages to another thread. */
 
-    /* Free any allocated overflows. */
-    /* XXX TODO */
+    /* Unmap the regions kept for reuse. Any large objects still around are
+     * usually transferred to another thread, just like the pages. */
+    MVMuint32 j;
+    for (j = 0; j < al->large->num_free_regions; j++)
+        unmap_region(al->large->free_regions[j].header, al->large->free_regions[j].size);
 
     /* Clean up allocator data structure. */
     free(al->size_classes);
     al->size_classes = NULL;
-    free(al->overflows);
-    al->overflows = NULL;
+    free(al->large->objects);
+    free(al->large->free_regions);
+    free(al->large);
+    al->large = NULL;
     free(al);
 }
 
@@ -132,90 +554,79 @@ void MVM_gc_gen2_destroy(MVMInstance *i, MVMGen2Allocator *al) {
 void MVM_gc_gen2_transfer(MVMThreadContext *src, MVMThreadContext *dest) {
     MVMGen2Allocator *gen2 = src->gen2, *dest_gen2 = dest->gen2;
     MVMuint32 bin, obj_size, page;
-    char ***freelist_insert_pos;
+
+    /* The pages we move must have been swept, since the destination only
+     * knows about sweeping its own. */
+    MVM_gc_gen2_sweep_all(src);
 
     for (bin = 0; bin < MVM_GEN2_BINS; bin++) {
-        MVMuint32 orig_dest_num_pages = dest_gen2->size_classes[bin].num_pages;
+        MVMGen2SizeClass *sc = &gen2->size_classes[bin], *dest_sc = &dest_gen2->size_classes[bin];
+        MVMuint32 orig_dest_num_pages = dest_sc->num_pages;
         char *cur_ptr, *end_ptr;
+        char **free_slot;
+
         /* If we've nothing allocated in this size class, skip it. */
-        if (gen2->size_classes[bin].pages == NULL)
+        if (sc->pages == NULL)
             continue;
 
-        if (dest_gen2->size_classes[bin].pages == NULL)
-            dest_gen2->size_classes[bin].free_list = NULL;
-
         /* Calculate object size for this bin. */
         obj_size = (bin + 1) << MVM_GEN2_BIN_BITS;
 
-        /* freelist_insert_pos is a pointer to a memory location that
-         * stores the address of the last traversed free list node (char **). */
-        /* Initialize freelist insertion position to free list head. */
-        freelist_insert_pos = &gen2->size_classes[bin].free_list;
-
-        if (dest_gen2->size_classes[bin].pages == NULL) {
-            dest_gen2->size_classes[bin].pages
-                = malloc(sizeof(void *) * gen2->size_classes[bin].num_pages);
-            dest_gen2->size_classes[bin].num_pages = gen2->size_classes[bin].num_pages;
+        if (dest_sc->pages == NULL) {
+            dest_sc->free_list = NULL;
+            dest_sc->pages     = malloc(sizeof(void *) * sc->num_pages);
+            dest_sc->num_pages = sc->num_pages;
         }
         else {
-            dest_gen2->size_classes[bin].num_pages
-                += gen2->size_classes[bin].num_pages;
-            dest_gen2->size_classes[bin].pages
-                = realloc(dest_gen2->size_classes[bin].pages,
-                    sizeof(void *) * dest_gen2->size_classes[bin].num_pages);
+            /* Chain what's left of the destination's current page into its
+             * free list, since it's about to take on our current page. */
+            for (cur_ptr = dest_sc->alloc_pos; cur_ptr < dest_sc->alloc_limit; cur_ptr += obj_size) {
+                ((char **)cur_ptr)[0] = (char *)dest_sc->free_list;
+                ((void **)cur_ptr)[1] = MVM_GEN2_FREE_MARKER;
+                dest_sc->free_list = (char **)cur_ptr;
+            }
+            dest_sc->num_pages += sc->num_pages;
+            dest_sc->pages = realloc(dest_sc->pages, sizeof(void *) * dest_sc->num_pages);
         }
 
         /* Visit each page in the source. */
-        for (page = 0; page < gen2->size_classes[bin].num_pages; page++) {
-            /* Visit all the objects, looking for dead ones and swap the
-             * owner for each of them. */
-            cur_ptr = gen2->size_classes[bin].pages[page];
-            end_ptr = page + 1 == gen2->size_classes[bin].num_pages
-                ? gen2->size_classes[bin].alloc_pos
+        for (page = 0; page < sc->num_pages; page++) {
+            /* Visit all the objects and swap the owner for each of them. */
+            cur_ptr = sc->pages[page];
+            end_ptr = page + 1 == sc->num_pages
+                ? sc->alloc_pos
                 : cur_ptr + obj_size * MVM_GEN2_PAGE_ITEMS;
-            while (cur_ptr < end_ptr) {
-                if (cur_ptr == (char *)freelist_insert_pos) {
-                    /* skip */
-                }
-                else if (cur_ptr == (char *)*freelist_insert_pos) {
-/*                    printf("found a free list slot in bin %d page %d: %d with value %d and start %d and limit %d\n",
-                        bin, page, cur_ptr, *(void **)cur_ptr, gen2->size_classes[bin].pages[page],
-                        dest_gen2->size_classes[bin].alloc_limit);*/
-                    freelist_insert_pos = (char ***)cur_ptr;
-                }
-                else { /* note: we don't have tests that exercise this path yet. */
-/*                    printf("updating an owner from %d to %d\n", ((MVMCollectable *)cur_ptr)->owner, dest->thread_id);*/
+            for ( ; cur_ptr < end_ptr; cur_ptr += obj_size)
+                if (!MVM_GEN2_IS_FREE(cur_ptr))
                     ((MVMCollectable *)cur_ptr)->owner = dest->thread_id;
-                }
-
-                /* Move to the next object. */
-                cur_ptr += obj_size;
-            }
-            dest_gen2->size_classes[bin].pages[page + orig_dest_num_pages] = gen2->size_classes[bin].pages[page];
+            dest_sc->pages[page + orig_dest_num_pages] = sc->pages[page];
         }
 
-        freelist_insert_pos = &dest_gen2->size_classes[bin].free_list;
-        while (*freelist_insert_pos) {
-            freelist_insert_pos = (char ***)*freelist_insert_pos;
+        /* Put our free list in front of the destination's. */
+        if (sc->free_list) {
+            free_slot = sc->free_list;
+            while (*free_slot)
+                free_slot = (char **)*free_slot;
+            *free_slot = (char *)dest_sc->free_list;
+            dest_sc->free_list = sc->free_list;
         }
-        /* chain the destination's freelist through any remaining unallocated area */
-        cur_ptr = (char *)freelist_insert_pos > dest_gen2->size_classes[bin].alloc_pos
-            ? (char *)freelist_insert_pos : dest_gen2->size_classes[bin].alloc_pos;
-        end_ptr = dest_gen2->size_classes[bin].alloc_limit;
-        while (cur_ptr < end_ptr) {
-            *freelist_insert_pos = (char **)cur_ptr;
-            freelist_insert_pos = (char ***)cur_ptr;
-            cur_ptr += obj_size;
-        }
-        /* link to the new pages, if any */
-        *freelist_insert_pos = gen2->size_classes[bin].free_list;
 
-        dest_gen2->size_classes[bin].alloc_pos = gen2->size_classes[bin].alloc_pos;
-        dest_gen2->size_classes[bin].alloc_limit = gen2->size_classes[bin].alloc_limit;
+        dest_sc->alloc_pos   = sc->alloc_pos;
+        dest_sc->alloc_limit = sc->alloc_limit;
 
-        free(gen2->size_classes[bin].pages);
-        gen2->size_classes[bin].pages = NULL;
-        gen2->size_classes[bin].num_pages = 0;
+        free(sc->pages);
+        sc->pages     = NULL;
+        sc->num_pages = 0;
+        sc->free_list = NULL;
+    }
+    { /* move the large objects; any marks of a concurrent marking cycle
+       * go with them, in their headers */
+        MVMuint32 i, n = gen2->large->num_objects;
+        for (i = 0; i < n; i++) {
+            gen2->large->objects[i]->owner = dest->thread_id;
+            large_add(dest_gen2->large, gen2->large->objects[i]);
+        }
+        gen2->large->num_objects = 0;
     }
     { /* copy the roots... */
         MVMuint32 i, n = src->num_gen2roots;
@@ -20,6 +20,18 @@ struct MVMGen2SizeClass {
 
     /* The number of pages allocated. */
     MVMuint32 num_pages;
+
+    /* Sweeping is done lazily after a full collection. Pages from
+     * cur_sweep_page up to num_sweep_pages are still to be swept, and the
+     * last of them only up to sweep_end (where allocation had got to). */
+    MVMuint32 cur_sweep_page;
+    MVMuint32 num_sweep_pages;
+    char     *sweep_end;
+
+    /* Pages being emptied by a full collection that defragments, which
+     * moves the live objects out of them; they are freed once it's over. */
+    char    **evac_pages;
+    MVMuint32 num_evac_pages;
 };
 
 /* An "instance" of the fixed size allocator. */
@@ -30,15 +42,48 @@ struct MVMGen2Allocator {
      * past the limit. */
     MVMGen2SizeClass *size_classes;
 
-    /* Array of objects that were malloc'd instead, because they did
-     * not fit in a size class due to being too large. */
-    MVMCollectable **overflows;
+    /* The large object space, for objects too big for a size class. */
+    MVMGen2LargeObjects *large;
+};
+
+/* Objects too large for a size class each get a page-aligned region of
+ * their own, which is never copied. The region starts with a header, and
+ * the object follows. */
+struct MVMGen2LargeHeader {
+    /* Whether the object was marked as live in a full collection. Only the
+     * owner sets it, but any thread may look at it, since the gen2 roots of
+     * a thread can include objects of others. */
+    MVMuint32 marked;
+
+    /* The size of the region, in bytes. */
+    MVMuint32 region_size;
 
-    /* The number of objects in the overflow array. */
-    MVMuint32        num_overflows;
+    /* Keeps the object that follows suitably aligned. */
+    MVMuint64 padding;
+};
+
+/* The large object space of a second generation allocator. */
+struct MVMGen2LargeObjects {
+    /* The large objects. Their marks are kept in their headers, rather
+     * than in the objects, so a full collection only writes to the first
+     * page of those that survive. */
+    MVMCollectable **objects;
+    MVMuint32        num_objects;
+    MVMuint32        alloc_objects;
+
+    /* Regions of dead objects, kept for reuse; those swept last come last,
+     * and are reused first. */
+    MVMGen2LargeRegion *free_regions;
+    MVMuint32           num_free_regions;
+};
 
-    /* The amount of space allocated in the overflow array. */
-    MVMuint32        alloc_overflows;
+/* A region of a dead large object, kept for reuse. All but the most recently
+ * freed few had their pages given back to the operating system after the
+ * sweep, so hold on to nothing but address space (and read as zeroes). */
+struct MVMGen2LargeRegion {
+    MVMGen2LargeHeader *header;
+    MVMuint32           size;
+    MVMuint32           released;
 };
 
 /* The number of bits we discard from the requested size when binning
@@ -55,18 +100,61 @@ struct MVMGen2Allocator {
 /* Mask used to know if we hit a size class exactly or have to round up. */
 #define MVM_GEN2_BIN_MASK   ((1 << MVM_GEN2_BIN_BITS) - 1)
 
-/* Number of bins in the FSA. Beyond this, we just degrade to malloc/free. */
+/* Number of bins in the FSA. Beyond this, objects go in the large object
+ * space. */
 #define MVM_GEN2_BINS       32
 
-/* Default overflow list size. */
-#define MVM_GEN2_OVERFLOWS  32
+/* The size of the largest object that goes in a size class. */
+#define MVM_GEN2_MAX_BIN_SIZE (MVM_GEN2_BINS << MVM_GEN2_BIN_BITS)
+
+/* Initial size of the large object tables. */
+#define MVM_GEN2_LARGE_OBJECTS 32
+
+/* Large object regions are a multiple of this size. */
+#define MVM_GEN2_LARGE_PAGE_SIZE 4096
+
+/* The most regions of dead large objects we keep around for reuse, and how
+ * many bytes of them may stay resident rather than be given back to the
+ * operating system. */
+#define MVM_GEN2_LARGE_FREE_REGIONS 1024
+#define MVM_GEN2_LARGE_RESIDENT     2097152
+
+/* The size of the region a large object of the given size gets. */
+#define MVM_GEN2_LARGE_REGION_SIZE(size) (((size) + sizeof(MVMGen2LargeHeader) \
+    + MVM_GEN2_LARGE_PAGE_SIZE - 1) & ~(MVM_GEN2_LARGE_PAGE_SIZE - 1))
+
+/* Gets the header of the region a large object lives in. */
+#define MVM_GEN2_LARGE_HEADER(c) ((MVMGen2LargeHeader *)((char *)(c) - sizeof(MVMGen2LargeHeader)))
 
 /* The number of items that go into each page. */
 #define MVM_GEN2_PAGE_ITEMS 256
 
+/* The number of pages swept after each GC run, if any are left. */
+#define MVM_GEN2_SWEEP_PAGES 64
+
+/* Free slots in a size class are chained through their first word. Their
+ * second word, where a collectable has its forwarder, holds this marker, so
+ * that a sweep can tell them apart from dead objects. */
+#define MVM_GEN2_FREE_MARKER ((void *)1)
+#define MVM_GEN2_IS_FREE(slot) (((void **)(slot))[1] == MVM_GEN2_FREE_MARKER)
+
+/* A full collection that defragments empties the pages of a size class
+ * that are no more than this percentage full, as far as the live objects
+ * in them fit into the free slots of the other pages. */
+#define MVM_GEN2_EVAC_OCCUPANCY 25
+
 /* Functions. */
 MVMGen2Allocator * MVM_gc_gen2_create(MVMInstance *i);
-void * MVM_gc_gen2_allocate(MVMGen2Allocator *al, MVMuint32 size);
-void * MVM_gc_gen2_allocate_zeroed(MVMGen2Allocator *al, MVMuint32 size);
+void * MVM_gc_gen2_allocate(MVMThreadContext *tc, MVMuint32 size);
+void * MVM_gc_gen2_allocate_zeroed(MVMThreadContext *tc, MVMuint32 size);
 void MVM_gc_gen2_destroy(MVMInstance *i, MVMGen2Allocator *allocator);
 void MVM_gc_gen2_transfer(MVMThreadContext *src, MVMThreadContext *dest);
+MVMuint32 MVM_gc_gen2_large_mark(MVMCollectable *c);
+MVMuint32 MVM_gc_gen2_is_marked(MVMCollectable *c);
+MVMCollectable * MVM_gc_gen2_survivor(MVMCollectable *c);
+MVMuint64 MVM_gc_gen2_large_sweep(MVMThreadContext *tc);
+void MVM_gc_gen2_start_sweep(MVMThreadContext *tc);
+MVMuint32 MVM_gc_gen2_sweep_some(MVMThreadContext *tc, MVMuint32 max_pages);
+void MVM_gc_gen2_sweep_all(MVMThreadContext *tc);
+void MVM_gc_gen2_start_evacuation(MVMThreadContext *tc);
+void MVM_gc_gen2_finish_evacuation(MVMThreadContext *tc);
@@ -21,6 +21,33 @@ static void add_work(MVMThreadContext *tc, MVMThreadContext *stolen) {
     tc->gc_work[tc->gc_work_count++].tc = stolen;
 }
 
+/* Puts a thread that can't take part in this GC run into the pool of those
+ * whose collection may be done by any thread that is taking part. */
+static void add_stealable(MVMThreadContext *tc, MVMThreadContext *stolen) {
+    MVMThreadContext * volatile *pool = &tc->instance->gc_stealable;
+    while (1) {
+        MVMThreadContext *head = *pool;
+        stolen->gc_next_stealable = head;
+        if (apr_atomic_casptr((volatile void **)pool, stolen, head) == head)
+            return;
+    }
+}
+
+/* Takes a thread out of the pool of those whose collection is still to be
+ * done, or returns NULL if there are none left. Threads are only added to
+ * the pool before the run starts, and only taken once it has, so the head
+ * we look at can't be taken and put back before we swap it out. */
+static MVMThreadContext * take_stealable(MVMThreadContext *tc) {
+    MVMThreadContext * volatile *pool = &tc->instance->gc_stealable;
+    while (1) {
+        MVMThreadContext *head = *pool;
+        if (head == NULL)
+            return NULL;
+        if (apr_atomic_casptr((volatile void **)pool, head->gc_next_stealable, head) == head)
+            return head;
+    }
+}
+
 /* Goes through all threads but the current one and notifies them that a
  * GC run is starting. Those that are blocked are considered excluded from
  * the run, and are not counted. Returns the count of threads that should be
@@ -47,7 +74,7 @@ static MVMuint32 signal_one_thread(MVMThreadContext *tc, MVMThreadContext *to_si
                 if (apr_atomic_cas32(&to_signal->gc_status, MVMGCStatus_STOLEN,
                         MVMGCStatus_UNABLE) == MVMGCStatus_UNABLE) {
                     GCORCH_LOG(tc, "Thread %d run %d : A blocked thread %d spotted; work stolen\n", to_signal->thread_id);
-                    add_work(tc, to_signal);
+                    add_stealable(tc, to_signal);
                     return 0;
                 }
                 break;
@@ -82,12 +109,12 @@ static MVMuint32 signal_all_but(MVMThreadContext *tc, MVMThread *t, MVMThread *t
                 break;
             case MVM_thread_stage_exited:
                 GCORCH_LOG(tc, "Thread %d run %d : queueing to clear nursery of thread %d\n", t->body.tc->thread_id);
-                add_work(tc, t->body.tc);
+                add_stealable(tc, t->body.tc);
                 break;
             case MVM_thread_stage_clearing_nursery:
                 GCORCH_LOG(tc, "Thread %d run %d : queueing to destroy thread %d\n", t->body.tc->thread_id);
                 /* last GC run for this thread */
-                add_work(tc, t->body.tc);
+                add_stealable(tc, t->body.tc);
                 break;
             case MVM_thread_stage_destroyed:
                 GCORCH_LOG(tc, "Thread %d run %d : found a destroyed thread\n");
@@ -144,6 +171,48 @@ static MVMuint32 process_sent_items(MVMThreadContext *tc, MVMuint32 *put_vote) {
     return 0;
 }
 
+/* Checks whether anything happened that a thread waiting for GC to finish
+ * must act on: work was passed to one of the threads it collects for, work
+ * that one of them passed on was taken, or the run is over. */
+static MVMuint32 has_progress(MVMThreadContext *tc) {
+    MVMuint32 i;
+    if (!tc->instance->gc_finish)
+        return 1;
+    for (i = 0; i < tc->gc_work_count; i++) {
+        MVMThreadContext *other = tc->gc_work[i].tc;
+        if (other->gc_in_tray)
+            return 1;
+        if (other->gc_next_to_check && other->gc_next_to_check->completed)
+            return 1;
+    }
+    return 0;
+}
+
+/* Sleeps until there is progress to act on. The check is made with the
+ * mutex held, and progress is signalled with it held, so we can't miss a
+ * wake-up that comes between the two. */
+static void wait_for_progress(MVMThreadContext *tc) {
+    MVMInstance *i = tc->instance;
+    if (apr_thread_mutex_lock(i->mutex_gc_progress) != APR_SUCCESS)
+        MVM_panic(MVM_exitcode_gcorch, "Unable to lock GC progress mutex");
+    while (!has_progress(tc))
+        apr_thread_cond_wait(i->cond_gc_progress, i->mutex_gc_progress);
+    if (apr_thread_mutex_unlock(i->mutex_gc_progress) != APR_SUCCESS)
+        MVM_panic(MVM_exitcode_gcorch, "Unable to unlock GC progress mutex");
+}
+
+/* Wakes up any threads waiting for GC progress, so they can see if it
+ * concerns them. Called after passing work to another thread, taking work
+ * that was passed, or casting the last vote to finish. */
+void MVM_gc_signal_progress(MVMThreadContext *tc) {
+    MVMInstance *i = tc->instance;
+    if (apr_thread_mutex_lock(i->mutex_gc_progress) != APR_SUCCESS)
+        MVM_panic(MVM_exitcode_gcorch, "Unable to lock GC progress mutex");
+    apr_thread_cond_broadcast(i->cond_gc_progress);
+    if (apr_thread_mutex_unlock(i->mutex_gc_progress) != APR_SUCCESS)
+        MVM_panic(MVM_exitcode_gcorch, "Unable to unlock GC progress mutex");
+}
+
 static void cleanup_sent_items(MVMThreadContext *tc) {
     MVMGCPassedWork *work, *next = tc->gc_sent_items;
     while ((work = next)) {
@@ -157,9 +226,11 @@ static void cleanup_sent_items(MVMThreadContext *tc) {
  * work yet, though. */
 static void finish_gc(MVMThreadContext *tc, MVMuint8 gen) {
     MVMuint32 put_vote = 1, i;
+    MVMuint64 live;
 
     /* Loop until other threads have terminated, processing any extra work
-     * that we are given. */
+     * that we are given. Rather than spinning on the vote count while there
+     * is nothing to do, we sleep until there may be. */
     while (tc->instance->gc_finish) {
         MVMuint32 failed = 0;
         MVMuint32 i = 0;
@@ -170,12 +241,27 @@ static void finish_gc(MVMThreadContext *tc, MVMuint8 gen) {
         }
 
         if (!failed && put_vote) {
-            MVM_atomic_decr(&tc->instance->gc_finish);
+            if (MVM_atomic_decr(&tc->instance->gc_finish) == 1)
+                MVM_gc_signal_progress(tc);
             put_vote = 0;
         }
+
+        wait_for_progress(tc);
     }
 /*    GCORCH_LOG(tc, "Thread %d run %d : Discovered GC termination\n");*/
 
+    /* In a full collection, the marking is over now. A thread's gen2 roots
+     * may be objects of other threads, so every thread must clean up those
+     * of the threads it collected before any of them sweeps, which clears
+     * the marks (or, for a large object, may free it). */
+    if (gen == MVMGCGenerations_Both) {
+        for (i = 0; i < tc->gc_work_count; i++)
+            MVM_gc_collect_cleanup_gen2roots(tc->gc_work[i].tc);
+        MVM_atomic_decr(&tc->instance->gc_gen2roots_pending);
+        while (tc->instance->gc_gen2roots_pending)
+            apr_thread_yield();
+    }
+
     /* Reset GC status flags and cleanup sent items for any work threads. */
     /* This is also where thread destruction happens, and it needs to happen
      * before we acknowledge this GC run is finished. */
@@ -184,10 +270,16 @@ static void finish_gc(MVMThreadContext *tc, MVMuint8 gen) {
         MVMThread *thread_obj = other->thread_obj;
         cleanup_sent_items(other);
         if (thread_obj->body.stage == MVM_thread_stage_clearing_nursery) {
-            GCORCH_LOG(tc, "Thread %d run %d : freeing gen2 of thread %d\n", other->thread_id);
-            /* always free gen2 */
-            MVM_gc_collect_free_gen2_unmarked(other);
+            /* always free gen2, unless it's being marked concurrently; the
+             * marks so far go with it, and it's swept after the remark */
+            if (!tc->instance->gc_marking) {
+                GCORCH_LOG(tc, "Thread %d run %d : freeing gen2 of thread %d\n", other->thread_id);
+                live = MVM_gc_collect_free_gen2_unmarked(other);
+                if (gen == MVMGCGenerations_Both)
+                    MVM_atomic_add(&tc->instance->gc_gen2_live_bytes, live);
+            }
             GCORCH_LOG(tc, "Thread %d run %d : transferring gen2 of thread %d\n", other->thread_id);
+            MVM_gc_concurrent_transfer(other, tc);
             MVM_gc_gen2_transfer(other, tc);
             GCORCH_LOG(tc, "Thread %d run %d : destroying thread %d\n", other->thread_id);
             MVM_tc_destroy(other);
@@ -213,6 +305,12 @@ static void finish_gc(MVMThreadContext *tc, MVMuint8 gen) {
  * This tells any thread that is coordinating a GC run that this thread will
  * be unable to participate. */
 void MVM_gc_mark_thread_blocked(MVMThreadContext *tc) {
+    /* We're about to sit idle, so it's a good time to finish sweeping, or
+     * to trace what we have left in a concurrent marking cycle. */
+    MVM_gc_gen2_sweep_all(tc);
+    if (tc->instance->gc_marking)
+        MVM_gc_concurrent_mark_some(tc, (MVMuint32)-1);
+
     /* This may need more than one attempt. */
     while (1) {
         /* Try to set it from running to unable - the common case. */
@@ -254,13 +352,18 @@ static void signal_child(MVMThreadContext *tc) {
     }
 }
 
-static void run_gc(MVMThreadContext *tc, MVMuint8 what_to_do) {
+/* Does a GC run's work for a thread, and that of any threads it collects
+ * for. Returns how long it waited for the others to finish, in microseconds. */
+static MVMuint64 run_gc(MVMThreadContext *tc, MVMuint8 what_to_do) {
     MVMuint8   gen;
     MVMThread *child;
+    MVMThreadContext *stolen;
     MVMuint32  i, n;
+    apr_time_t wait_start;
+    MVMuint64  wait_us;
 
     /* Do GC work for this thread, or at least all we know about. */
-    gen = tc->instance->gc_seq_number % MVM_GC_GEN2_RATIO == 0
+    gen = tc->instance->gc_full_collection
         ? MVMGCGenerations_Both
         : MVMGCGenerations_Nursery;
 
@@ -273,8 +376,22 @@ static void run_gc(MVMThreadContext *tc, MVMuint8 what_to_do) {
         MVM_gc_collect(other, (other == tc ? what_to_do : MVMGCWhatToDo_NoInstance), gen);
     }
 
+    /* Having done that, take on the collection of threads that could not
+     * take part themselves, until there are none left. Each is then ours
+     * to finish off, just as if we had stolen it when signalling. */
+    while ((stolen = take_stealable(tc))) {
+        add_work(tc, stolen);
+        tc->gc_work[tc->gc_work_count - 1].limit = stolen->nursery_alloc;
+        GCORCH_LOG(tc, "Thread %d run %d : starting collection for stolen thread %d\n",
+            stolen->thread_id);
+        MVM_atomic_incr(&tc->instance->gc_stats->stolen_threads);
+        MVM_gc_collect(stolen, MVMGCWhatToDo_NoInstance, gen);
+    }
+
     /* Wait for everybody to agree we're done. */
+    wait_start = apr_time_now();
     finish_gc(tc, gen);
+    wait_us = apr_time_now() - wait_start;
 
     /* Now we're all done, it's safe to finalize any objects that need it. */
     for (i = 0, n = tc->gc_work_count ; i < n; i++) {
@@ -287,13 +404,34 @@ static void run_gc(MVMThreadContext *tc, MVMuint8 what_to_do) {
         thread_obj = other->thread_obj;
 
         MVM_gc_collect_free_nursery_uncopied(other, tc->gc_work[i].limit);
+        MVM_gc_collect_resize_nursery(other, tc->gc_work[i].limit);
 
         if (gen == MVMGCGenerations_Both) {
             GCORCH_LOG(tc, "Thread %d run %d : freeing gen2 of thread %d\n", other->thread_id);
-            MVM_gc_collect_cleanup_gen2roots(other);
-            MVM_gc_collect_free_gen2_unmarked(other);
+            MVM_atomic_add(&tc->instance->gc_gen2_live_bytes,
+                MVM_gc_collect_free_gen2_unmarked(other));
+            MVM_gc_stats_add_gen2(tc, other->gen2);
         }
+        else {
+            MVM_atomic_add(&tc->instance->gc_promoted_bytes, other->gc_promoted_bytes);
+        }
+        MVM_atomic_add(&tc->instance->gc_stats->promoted_bytes, other->gc_promoted_bytes);
+        other->gc_promoted_bytes = 0;
     }
+
+    /* If we handed over objects greyed by other threads than their owners,
+     * they have all been taken by now. */
+    MVM_gc_concurrent_free_foreign(tc);
+
+    /* The world is running again; sweep some of our gen2 pages that are
+     * still to be swept after a full collection, so that fewer are left
+     * to sweep on demand when allocating. Or, in a concurrent marking
+     * cycle, trace some of our grey objects. */
+    MVM_gc_gen2_sweep_some(tc, MVM_GEN2_SWEEP_PAGES);
+    if (tc->instance->gc_marking)
+        MVM_gc_concurrent_mark_some(tc, tc->nursery_size / MVM_GC_MARK_SLICE_RATE);
+
+    return wait_us;
 }
 
 /* This is called when the allocator finds it has run out of memory and wants
@@ -301,6 +439,7 @@ static void run_gc(MVMThreadContext *tc, MVMuint8 what_to_do) {
  * will need to do that triggering, notifying other running threads that the
  * time has come to GC. */
 void MVM_gc_enter_from_allocator(MVMThreadContext *tc) {
+    apr_time_t start = apr_time_now();
 
     GCORCH_LOG(tc, "Thread %d run %d : Entered from allocate\n");
 
@@ -308,11 +447,16 @@ void MVM_gc_enter_from_allocator(MVMThreadContext *tc) {
     if (MVM_trycas(&tc->instance->gc_start, 0, 1)) {
         MVMThread *last_starter = NULL;
         MVMuint32 num_threads = 0;
+        AO_t threshold;
+        MVMuint8 snapshot;
+        MVMuint32 seq_number;
+        const char *kind;
+        MVMuint64 wait_us, pause_us;
 
         /* We are the winner of the GC starting race. This gives us some
          * extra responsibilities as well as doing the usual things.
          * First, increment GC sequence number. */
-        tc->instance->gc_seq_number++;
+        seq_number = ++tc->instance->gc_seq_number;
         GCORCH_LOG(tc, "Thread %d run %d : GC thread elected coordinator: starting gc seq %d\n", tc->instance->gc_seq_number);
 
         /* Ensure our stolen list is empty. */
@@ -350,13 +494,65 @@ void MVM_gc_enter_from_allocator(MVMThreadContext *tc) {
             MVM_panic(MVM_exitcode_gcorch, "finish votes was %d\n", tc->instance->gc_finish);
 
         tc->instance->gc_ack = tc->instance->gc_finish = num_threads + 1;
+        tc->instance->gc_gen2roots_pending = num_threads + 1;
+
+        /* Decide whether this run also collects gen2, which it does once
+         * enough was promoted since the last time that it has grown by the
+         * configured share of what was live then. The counts are only added
+         * to after a run finishes, so nobody touches them while we look.
+         * When marking concurrently, that starts a marking cycle instead,
+         * and the full collection is the remark that ends it, once there's
+         * nothing left to trace (or as much was promoted again meanwhile,
+         * since then the marking is not keeping up). A heap snapshot is
+         * taken at the start of a full collection, so if one was asked for,
+         * this run is one. */
+        snapshot  = tc->instance->gc_snapshot != NULL;
+        threshold = tc->instance->gc_gen2_live_bytes / 100 * tc->instance->gc_gen2_growth;
+        if (threshold < MVM_GC_GEN2_MIN_GROWTH)
+            threshold = MVM_GC_GEN2_MIN_GROWTH;
+        if (tc->instance->gc_marking) {
+            tc->instance->gc_full_collection = snapshot || tc->instance->gc_grey_pending == 0
+                || tc->instance->gc_promoted_bytes > threshold;
+            tc->instance->gc_remark = tc->instance->gc_full_collection;
+            if (tc->instance->gc_remark)
+                tc->instance->gc_marking = 0;
+        }
+        else if (!snapshot && tc->instance->gc_promoted_bytes > threshold && tc->instance->gc_concurrent_mark) {
+            tc->instance->gc_full_collection = tc->instance->gc_remark = 0;
+            tc->instance->gc_marking = 1;
+            tc->instance->gc_promoted_bytes = 0;
+        }
+        else {
+            tc->instance->gc_full_collection = snapshot || tc->instance->gc_promoted_bytes > threshold;
+            tc->instance->gc_remark = 0;
+        }
+        if (tc->instance->gc_full_collection)
+            tc->instance->gc_promoted_bytes = tc->instance->gc_gen2_live_bytes = 0;
+        MVM_gc_stats_start_run(tc, tc->instance->gc_full_collection
+            ? MVMGCGenerations_Both
+            : MVMGCGenerations_Nursery);
+        kind = tc->instance->gc_remark ? "remark"
+             : tc->instance->gc_full_collection ? "full"
+             : tc->instance->gc_marking ? "marking"
+             : "nursery";
+        GCORCH_LOG(tc, "Thread %d run %d : full collection is %d\n", (int)tc->instance->gc_full_collection);
+        GCORCH_LOG(tc, "Thread %d run %d : concurrent marking is %d\n", (int)tc->instance->gc_marking);
         GCORCH_LOG(tc, "Thread %d run %d : finish votes is %d\n", (int)tc->instance->gc_finish);
 
+        /* Every other thread is stopped until we signal them, so it's
+         * the time to take a heap snapshot, if one was asked for. */
+        if (tc->instance->gc_snapshot)
+            MVM_gc_snapshot_take(tc);
+
         /* signal to the rest to start */
         if (MVM_atomic_decr(&tc->instance->gc_start) != 1)
             MVM_panic(MVM_exitcode_gcorch, "start votes was %d\n", tc->instance->gc_finish);
 
-        run_gc(tc, MVMGCWhatToDo_All);
+        wait_us  = run_gc(tc, MVMGCWhatToDo_All);
+        pause_us = apr_time_now() - start;
+        MVM_gc_stats_record_pause(tc, pause_us, wait_us);
+        if (tc->instance->gc_stats->log)
+            MVM_gc_stats_log_run(tc, seq_number, kind, num_threads + 1, pause_us, wait_us);
     }
     else {
         /* Another thread beat us to starting the GC sync process. Thus, act as
@@ -370,7 +566,9 @@ void MVM_gc_enter_from_allocator(MVMThreadContext *tc) {
  * that another thread is already trying to start a GC run, so we don't need to
  * try and do that, just enlist in the run. */
 void MVM_gc_enter_from_interrupt(MVMThreadContext *tc) {
+    apr_time_t start = apr_time_now();
     MVMuint8 decr = 0;
+    MVMuint64 wait_us;
     AO_t curr;
 
     tc->gc_work_count = 0;
@@ -394,5 +592,6 @@ void MVM_gc_enter_from_interrupt(MVMThreadContext *tc) {
     /*    apr_sleep(1);
         apr_thread_yield();*/
     }
-    run_gc(tc, MVMGCWhatToDo_NoInstance);
+    wait_us = run_gc(tc, MVMGCWhatToDo_NoInstance);
+    MVM_gc_stats_record_pause(tc, apr_time_now() - start, wait_us);
 }
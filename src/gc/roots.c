@@ -1,7 +1,5 @@
 #include "moarvm.h"
 
-static void scan_registers(MVMThreadContext *tc, MVMGCWorklist *worklist, MVMFrame *frame);
-
 /* Adds a location holding a collectable object to the permanent list of GC
  * roots, so that it will always be marked and never die. Note that the
  * address of the collectable must be passed, since it will need to be
@@ -137,27 +135,48 @@ void MVM_gc_root_gen2_add(MVMThreadContext *tc, MVMCollectable *c) {
     c->flags |= MVM_CF_IN_GEN2_ROOT_LIST;
 }
 
-/* Adds the set of thread-local inter-generational roots to a GC worklist. */
-void MVM_gc_root_add_gen2s_to_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist) {
-    MVMCollectable **gen2roots = tc->gen2roots;
-    MVMuint32        num_roots = tc->num_gen2roots;
-    MVMuint32        i;
-
-    /* Mark gen2 objects that point to nursery things. */
-    for (i = 0; i < num_roots; i++)
-        MVM_gc_mark_collectable(tc, worklist, gen2roots[i]);
-}
+/* Tells whether a collectable is in the nursery. */
+#define IN_NURSERY(c) ((c) && !(((MVMCollectable *)(c))->flags & MVM_CF_SECOND_GEN))
 
-/* Visits all of the roots in the gen2 list and removes those that have been
- * collected. Applied after a full collection. */
-void MVM_gc_root_gen2_cleanup(MVMThreadContext *tc) {
+/* Adds the set of thread-local inter-generational roots to a GC worklist.
+ * Objects with a card table only have their dirty cards marked, and once
+ * none of their cards are dirty they no longer point to any nursery objects,
+ * so are removed from the roots. */
+void MVM_gc_root_add_gen2s_to_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist) {
     MVMCollectable **gen2roots    = tc->gen2roots;
     MVMuint32        num_roots    = tc->num_gen2roots;
     MVMuint32        cur_survivor = 0;
     MVMuint32        i;
-    for (i = 0; i < num_roots; i++)
-        if (gen2roots[i]->forwarder)
-            gen2roots[cur_survivor++] = gen2roots[i]->forwarder;
+
+    /* Mark gen2 objects that point to nursery things. */
+    for (i = 0; i < num_roots; i++) {
+        MVMCollectable *c = gen2roots[i];
+        MVMObject      *o = (MVMObject *)c;
+        if (!(c->flags & (MVM_CF_TYPE_OBJECT | MVM_CF_STABLE)) && REPR(o)->gc_mark_cards) {
+            MVMuint32 all   = c->flags & MVM_CF_SCAN_ALL_CARDS;
+            MVMuint32 dirty = 0;
+            c->flags &= ~MVM_CF_SCAN_ALL_CARDS;
+            if (all) {
+                /* The header may be what points into the nursery. */
+                if (IN_NURSERY(c->sc) || IN_NURSERY(o->st)) {
+                    c->flags |= MVM_CF_SCAN_ALL_CARDS;
+                    dirty = 1;
+                }
+                MVM_gc_worklist_add(tc, worklist, &c->sc);
+                MVM_gc_worklist_add(tc, worklist, &o->st);
+            }
+            if (REPR(o)->gc_mark_cards(tc, STABLE(o), OBJECT_BODY(o), worklist, all))
+                dirty = 1;
+            if (!dirty) {
+                c->flags &= ~MVM_CF_IN_GEN2_ROOT_LIST;
+                continue;
+            }
+        }
+        else {
+            MVM_gc_mark_collectable(tc, worklist, c);
+        }
+        gen2roots[cur_survivor++] = c;
+    }
     tc->num_gen2roots = cur_survivor;
 }
 
@@ -183,11 +202,11 @@ void MVM_gc_root_add_frame_roots_to_worklist(MVMThreadContext *tc, MVMGCWorklist
     MVM_gc_worklist_add(tc, worklist, &cur_frame->static_info);
 
     /* Scan the registers. */
-    scan_registers(tc, worklist, cur_frame);
+    MVM_gc_root_add_frame_registers_to_worklist(tc, worklist, cur_frame);
 }
 
 /* Takes a frame, scans its registers and adds them to the roots. */
-static void scan_registers(MVMThreadContext *tc, MVMGCWorklist *worklist, MVMFrame *frame) {
+void MVM_gc_root_add_frame_registers_to_worklist(MVMThreadContext *tc, MVMGCWorklist *worklist, MVMFrame *frame) {
     MVMuint16  i, count;
     MVMuint16 *type_map;
     MVMuint8  *flag_map;
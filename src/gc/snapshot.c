@@ -0,0 +1,359 @@
+#include "moarvm.h"
+
+/* Heap snapshots, for finding out what is alive and what keeps it so. One
+ * is asked for by the heapsnapshot op, and taken by the thread coordinating
+ * the next GC run (which is made a full collection) once every other thread
+ * has stopped, before anything is collected. It walks everything reachable
+ * from the roots, finding each thing's references with the same gc_mark
+ * callbacks that the collector uses, but without marking or moving
+ * anything.
+ *
+ * The snapshot file starts with the 8 bytes "MVMHEAP1". Records follow, each
+ * starting with a byte that tells what it is. The numbers in them are 32-bit
+ * ones, in the byte order of the machine that wrote it:
+ *
+ *   'n' a name:   number, length, then that many bytes of UTF-8
+ *   'o' a thing:  number, name number, size in bytes, kind (a byte, see
+ *                 snapshot.h), the number of references, and the numbers
+ *                 of the things referenced
+ *   'r' a root:   kind (a byte, see snapshot.h), the ID of the thread it's
+ *                 a root of (0 if it belongs to the instance), and the
+ *                 number of the thing
+ *   'e' the end
+ *
+ * Things are numbered from 0 in the order they are found, and only written
+ * later, so references may be to things that are yet to be written. Names
+ * are written before they are first used. Sizes are those of the things
+ * themselves, leaving out any memory that they manage on their own. */
+
+/* A table from addresses to the numbers they were given in the snapshot,
+ * using open addressing. */
+typedef struct {
+    void     **keys;
+    MVMuint32 *values;
+    MVMuint32  num_keys;
+    MVMuint32  alloc_keys;
+} AddressTable;
+
+/* A snapshot being taken. */
+typedef struct {
+    FILE          *file;
+
+    /* Collectables and frames found, and the number the next one gets. */
+    AddressTable   things;
+    MVMuint32      num_things;
+
+    /* Names, going by the STable or static frame they're for. */
+    AddressTable   names;
+    MVMuint32      num_names;
+
+    /* Things found but not yet written. */
+    MVMCollectable **todo_collectables;
+    MVMuint32        num_todo_collectables;
+    MVMuint32        alloc_todo_collectables;
+    MVMFrame       **todo_frames;
+    MVMuint32        num_todo_frames;
+    MVMuint32        alloc_todo_frames;
+
+    /* The references of the thing being written. */
+    MVMuint32     *refs;
+    MVMuint32      num_refs;
+    MVMuint32      alloc_refs;
+
+    MVMGCWorklist *worklist;
+} Snapshot;
+
+/* Finds where an address is or would go in a table. */
+static MVMuint32 table_slot(AddressTable *table, void *key) {
+    MVMuint32 mask = table->alloc_keys - 1;
+    MVMuint32 slot = (MVMuint32)(((uintptr_t)key >> 3) * 2654435761U) & mask;
+    while (table->keys[slot] && table->keys[slot] != key)
+        slot = (slot + 1) & mask;
+    return slot;
+}
+
+/* Looks up an address in a table, giving 1 and its number if it's there. */
+static MVMuint32 table_get(AddressTable *table, void *key, MVMuint32 *value) {
+    MVMuint32 slot;
+    if (!table->alloc_keys)
+        return 0;
+    slot = table_slot(table, key);
+    if (!table->keys[slot])
+        return 0;
+    *value = table->values[slot];
+    return 1;
+}
+
+/* Adds an address that isn't there yet to a table, growing it so it never
+ * gets more than half full. */
+static void table_put(AddressTable *table, void *key, MVMuint32 value) {
+    MVMuint32 slot;
+    if ((table->num_keys + 1) * 2 > table->alloc_keys) {
+        void     **old_keys   = table->keys;
+        MVMuint32 *old_values = table->values;
+        MVMuint32  old_alloc  = table->alloc_keys;
+        MVMuint32  i;
+        table->alloc_keys = old_alloc ? old_alloc * 2 : 1024;
+        table->keys       = calloc(table->alloc_keys, sizeof(void *));
+        table->values     = malloc(table->alloc_keys * sizeof(MVMuint32));
+        for (i = 0; i < old_alloc; i++) {
+            if (old_keys[i]) {
+                slot = table_slot(table, old_keys[i]);
+                table->keys[slot]   = old_keys[i];
+                table->values[slot] = old_values[i];
+            }
+        }
+        free(old_keys);
+        free(old_values);
+    }
+    slot = table_slot(table, key);
+    table->keys[slot]   = key;
+    table->values[slot] = value;
+    table->num_keys++;
+}
+
+static void write_u8(Snapshot *ss, MVMuint8 value) {
+    fwrite(&value, 1, 1, ss->file);
+}
+static void write_u32(Snapshot *ss, MVMuint32 value) {
+    fwrite(&value, sizeof(MVMuint32), 1, ss->file);
+}
+
+/* Gives the number of the name for a key, writing the name out the first
+ * time; the name is made of up to two strings. */
+static MVMuint32 get_name(MVMThreadContext *tc, Snapshot *ss, void *key,
+        const char *prefix, MVMString *name) {
+    MVMuint32 number;
+    char     *name_c;
+    size_t    prefix_len = strlen(prefix);
+    size_t    name_len;
+
+    if (table_get(&ss->names, key, &number))
+        return number;
+    number = ss->num_names++;
+    table_put(&ss->names, key, number);
+
+    name_c   = name ? MVM_string_utf8_encode_C_string(tc, name) : NULL;
+    name_len = name_c ? strlen(name_c) : 0;
+    write_u8(ss, 'n');
+    write_u32(ss, number);
+    write_u32(ss, (MVMuint32)(prefix_len + (name_c ? 1 + name_len : 0)));
+    fwrite(prefix, 1, prefix_len, ss->file);
+    if (name_c) {
+        fwrite(" ", 1, 1, ss->file);
+        fwrite(name_c, 1, name_len, ss->file);
+        free(name_c);
+    }
+    return number;
+}
+
+/* Gives the number of the name of a type, which is that of its REPR, and
+ * that of the type itself if its meta-object is a KnowHOW. */
+static MVMuint32 type_name(MVMThreadContext *tc, Snapshot *ss, MVMSTable *st) {
+    MVMObject *HOW  = st->HOW;
+    MVMString *name = NULL;
+    char *repr_name;
+    MVMuint32 number;
+    if (table_get(&ss->names, st, &number))
+        return number;
+    if (HOW && IS_CONCRETE(HOW) && REPR(HOW)->ID == MVM_REPR_ID_KnowHOWREPR)
+        name = ((MVMKnowHOWREPR *)HOW)->body.name;
+    repr_name = MVM_string_utf8_encode_C_string(tc, st->REPR->name);
+    number = get_name(tc, ss, st, repr_name, name);
+    free(repr_name);
+    return number;
+}
+
+/* Gives the number of a collectable or frame, numbering it and leaving it
+ * to be written if it wasn't found before. */
+static MVMuint32 find_collectable(Snapshot *ss, MVMCollectable *c) {
+    MVMuint32 number;
+    if (table_get(&ss->things, c, &number))
+        return number;
+    number = ss->num_things++;
+    table_put(&ss->things, c, number);
+    if (ss->num_todo_collectables == ss->alloc_todo_collectables) {
+        ss->alloc_todo_collectables = ss->alloc_todo_collectables ? ss->alloc_todo_collectables * 2 : 256;
+        ss->todo_collectables = realloc(ss->todo_collectables,
+            ss->alloc_todo_collectables * sizeof(MVMCollectable *));
+    }
+    ss->todo_collectables[ss->num_todo_collectables++] = c;
+    return number;
+}
+static MVMuint32 find_frame(Snapshot *ss, MVMFrame *f) {
+    MVMuint32 number;
+    if (table_get(&ss->things, f, &number))
+        return number;
+    number = ss->num_things++;
+    table_put(&ss->things, f, number);
+    if (ss->num_todo_frames == ss->alloc_todo_frames) {
+        ss->alloc_todo_frames = ss->alloc_todo_frames ? ss->alloc_todo_frames * 2 : 64;
+        ss->todo_frames = realloc(ss->todo_frames, ss->alloc_todo_frames * sizeof(MVMFrame *));
+    }
+    ss->todo_frames[ss->num_todo_frames++] = f;
+    return number;
+}
+
+/* Takes what was put in the worklist, and adds it to the references. */
+static void take_refs(MVMThreadContext *tc, Snapshot *ss) {
+    MVMCollectable **item_ptr;
+    MVMFrame        *frame;
+    while ((item_ptr = MVM_gc_worklist_get(tc, ss->worklist))) {
+        if (!*item_ptr)
+            continue;
+        if (ss->num_refs == ss->alloc_refs) {
+            ss->alloc_refs = ss->alloc_refs ? ss->alloc_refs * 2 : 64;
+            ss->refs = realloc(ss->refs, ss->alloc_refs * sizeof(MVMuint32));
+        }
+        ss->refs[ss->num_refs++] = find_collectable(ss, *item_ptr);
+    }
+    while ((frame = MVM_gc_worklist_get_frame(tc, ss->worklist))) {
+        if (ss->num_refs == ss->alloc_refs) {
+            ss->alloc_refs = ss->alloc_refs ? ss->alloc_refs * 2 : 64;
+            ss->refs = realloc(ss->refs, ss->alloc_refs * sizeof(MVMuint32));
+        }
+        ss->refs[ss->num_refs++] = find_frame(ss, frame);
+    }
+}
+
+/* Writes out a thing, with the references that were taken. */
+static void write_thing(Snapshot *ss, MVMuint32 number, MVMuint32 name, MVMuint32 size, MVMuint8 kind) {
+    write_u8(ss, 'o');
+    write_u32(ss, number);
+    write_u32(ss, name);
+    write_u32(ss, size);
+    write_u8(ss, kind);
+    write_u32(ss, ss->num_refs);
+    fwrite(ss->refs, sizeof(MVMuint32), ss->num_refs, ss->file);
+    ss->num_refs = 0;
+}
+
+static void write_collectable(MVMThreadContext *tc, Snapshot *ss, MVMCollectable *c) {
+    MVMuint32 number, name;
+    MVMuint8  kind;
+    table_get(&ss->things, c, &number);
+    if (c->flags & MVM_CF_STABLE) {
+        kind = MVM_SNAPSHOT_STABLE;
+        name = type_name(tc, ss, (MVMSTable *)c);
+    }
+    else {
+        kind = c->flags & MVM_CF_TYPE_OBJECT ? MVM_SNAPSHOT_TYPE_OBJECT : MVM_SNAPSHOT_OBJECT;
+        name = type_name(tc, ss, STABLE((MVMObject *)c));
+    }
+    MVM_gc_mark_collectable(tc, ss->worklist, c);
+    take_refs(tc, ss);
+    write_thing(ss, number, name, MVM_gc_collectable_size(c), kind);
+}
+
+static void write_frame(MVMThreadContext *tc, Snapshot *ss, MVMFrame *f) {
+    MVMStaticFrameBody *sfb = &f->static_info->body;
+    MVMuint32 number, name;
+    MVMuint32 size = sizeof(MVMFrame);
+    table_get(&ss->things, f, &number);
+    name = get_name(tc, ss, f->static_info, "Frame", sfb->name);
+    if (f->work)
+        size += sfb->work_size;
+    if (f->env)
+        size += sfb->env_size;
+
+    MVM_gc_worklist_add_frame(tc, ss->worklist, f->caller);
+    MVM_gc_worklist_add_frame(tc, ss->worklist, f->outer);
+    MVM_gc_worklist_add(tc, ss->worklist, &f->code_ref);
+    MVM_gc_worklist_add(tc, ss->worklist, &f->static_info);
+    MVM_gc_root_add_frame_registers_to_worklist(tc, ss->worklist, f);
+    take_refs(tc, ss);
+    write_thing(ss, number, name, size, MVM_SNAPSHOT_FRAME);
+}
+
+/* Writes a root. */
+static void write_root(Snapshot *ss, MVMuint8 kind, MVMuint32 thread_id, MVMuint32 number) {
+    write_u8(ss, 'r');
+    write_u8(ss, kind);
+    write_u32(ss, thread_id);
+    write_u32(ss, number);
+}
+
+/* Writes the roots that were put in the worklist; any frames there (such as
+ * a thread's current frame) are written as frame roots. */
+static void write_roots(MVMThreadContext *tc, Snapshot *ss, MVMuint8 kind, MVMuint32 thread_id) {
+    MVMCollectable **item_ptr;
+    MVMFrame        *frame;
+    while ((item_ptr = MVM_gc_worklist_get(tc, ss->worklist)))
+        if (*item_ptr)
+            write_root(ss, kind, thread_id, find_collectable(ss, *item_ptr));
+    while ((frame = MVM_gc_worklist_get_frame(tc, ss->worklist)))
+        write_root(ss, MVM_SNAPSHOT_ROOT_FRAME, thread_id, find_frame(ss, frame));
+}
+
+/* Asks for a heap snapshot to be written to the given file, and waits for
+ * it to be taken. */
+void MVM_gc_snapshot_request(MVMThreadContext *tc, MVMString *filename) {
+    char *path = MVM_string_utf8_encode_C_string(tc, filename);
+    FILE *file = fopen(path, "wb");
+    free(path);
+    if (!file)
+        MVM_exception_throw_adhoc(tc, "Unable to open the file to write a heap snapshot to");
+    if (!MVM_trycas(&tc->instance->gc_snapshot, NULL, file)) {
+        fclose(file);
+        MVM_exception_throw_adhoc(tc, "A heap snapshot is already being taken");
+    }
+
+    /* The run we start may not be the one that takes the snapshot, if some
+     * other thread started one first; if so, start another. */
+    while (tc->instance->gc_snapshot == file)
+        MVM_gc_enter_from_allocator(tc);
+}
+
+/* Takes the snapshot that was asked for. Called by the thread coordinating
+ * a GC run, while every other thread is stopped. */
+void MVM_gc_snapshot_take(MVMThreadContext *tc) {
+    MVMInstance *i = tc->instance;
+    MVMSerializationContextBody *scb, *tmp;
+    MVMThread *thread;
+    Snapshot   ss;
+
+    memset(&ss, 0, sizeof(Snapshot));
+    ss.file     = (FILE *)i->gc_snapshot;
+    ss.worklist = MVM_gc_worklist_create(tc);
+    fwrite("MVMHEAP1", 1, 8, ss.file);
+
+    /* Write the roots: those of the instance, then those of each thread. */
+    MVM_gc_root_add_permanents_to_worklist(tc, ss.worklist);
+    write_roots(tc, &ss, MVM_SNAPSHOT_ROOT_PERMANENT, 0);
+    MVM_gc_root_add_instance_roots_to_worklist(tc, ss.worklist);
+    write_roots(tc, &ss, MVM_SNAPSHOT_ROOT_INSTANCE, 0);
+    HASH_ITER(hash_handle, i->sc_weakhash, scb, tmp) {
+        MVM_gc_worklist_add(tc, ss.worklist, &scb->sc);
+    }
+    write_roots(tc, &ss, MVM_SNAPSHOT_ROOT_SC, 0);
+    for (thread = i->threads; thread; thread = thread->body.next) {
+        MVMThreadContext *thread_tc = thread->body.tc;
+        if (!thread_tc || thread->body.stage == MVM_thread_stage_destroyed)
+            continue;
+        MVM_gc_worklist_add(tc, ss.worklist, &thread_tc->thread_obj);
+        MVM_gc_root_add_tc_roots_to_worklist(thread_tc, ss.worklist);
+        write_roots(tc, &ss, MVM_SNAPSHOT_ROOT_THREAD, thread_tc->thread_id);
+        MVM_gc_root_add_temps_to_worklist(thread_tc, ss.worklist);
+        write_roots(tc, &ss, MVM_SNAPSHOT_ROOT_TEMPORARY, thread_tc->thread_id);
+    }
+
+    /* Write everything they lead to. */
+    while (ss.num_todo_collectables || ss.num_todo_frames) {
+        if (ss.num_todo_frames)
+            write_frame(tc, &ss, ss.todo_frames[--ss.num_todo_frames]);
+        else
+            write_collectable(tc, &ss, ss.todo_collectables[--ss.num_todo_collectables]);
+    }
+    write_u8(&ss, 'e');
+
+    fclose(ss.file);
+    MVM_gc_worklist_destroy(tc, ss.worklist);
+    free(ss.things.keys);
+    free(ss.things.values);
+    free(ss.names.keys);
+    free(ss.names.values);
+    free(ss.todo_collectables);
+    free(ss.todo_frames);
+    free(ss.refs);
+    i->gc_snapshot = NULL;
+}
@@ -0,0 +1,17 @@
+/* The kinds of things in a heap snapshot. */
+#define MVM_SNAPSHOT_OBJECT         0
+#define MVM_SNAPSHOT_TYPE_OBJECT    1
+#define MVM_SNAPSHOT_STABLE         2
+#define MVM_SNAPSHOT_FRAME          3
+
+/* The kinds of roots in a heap snapshot. */
+#define MVM_SNAPSHOT_ROOT_PERMANENT 0
+#define MVM_SNAPSHOT_ROOT_INSTANCE  1
+#define MVM_SNAPSHOT_ROOT_SC        2
+#define MVM_SNAPSHOT_ROOT_THREAD    3
+#define MVM_SNAPSHOT_ROOT_TEMPORARY 4
+#define MVM_SNAPSHOT_ROOT_FRAME     5
+
+/* Functions. */
+void MVM_gc_snapshot_request(MVMThreadContext *tc, MVMString *filename);
+void MVM_gc_snapshot_take(MVMThreadContext *tc);
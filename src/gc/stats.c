@@ -0,0 +1,123 @@
+#include "moarvm.h"
+
+/* Counts a GC run, which the thread coordinating it is about to start. If
+ * it's a full collection, the size class bytes are about to be counted
+ * afresh as each thread finishes freeing its second generation. */
+void MVM_gc_stats_start_run(MVMThreadContext *tc, MVMuint8 gen) {
+    MVMGCStats *stats = tc->instance->gc_stats;
+    MVMuint32 bin;
+    if (gen == MVMGCGenerations_Both) {
+        MVM_atomic_incr(&stats->full_runs);
+        for (bin = 0; bin < MVM_GEN2_BINS; bin++)
+            stats->gen2_class_bytes[bin] = 0;
+        stats->gen2_large_bytes = 0;
+    }
+    else {
+        MVM_atomic_incr(&stats->nursery_runs);
+    }
+}
+
+/* Records how long a thread was paused for a GC run, and how much of that
+ * it spent waiting for the other threads to finish. */
+void MVM_gc_stats_record_pause(MVMThreadContext *tc, MVMuint64 pause_us, MVMuint64 wait_us) {
+    MVMGCStats *stats = tc->instance->gc_stats;
+    MVMuint32 bucket = 0;
+    AO_t max;
+
+    while (bucket < MVM_GC_PAUSE_BUCKETS - 1 && (pause_us >> (bucket + 1)))
+        bucket++;
+    MVM_atomic_incr(&stats->pauses[bucket]);
+    MVM_atomic_add(&stats->pause_total_us, (AO_t)pause_us);
+    MVM_atomic_add(&stats->finish_wait_us, (AO_t)wait_us);
+    while ((max = stats->pause_max_us) < pause_us)
+        if (MVM_trycas(&stats->pause_max_us, max, (AO_t)pause_us))
+            break;
+}
+
+/* Adds up the bytes in a second generation, once a full collection freed
+ * what died in it. */
+void MVM_gc_stats_add_gen2(MVMThreadContext *tc, MVMGen2Allocator *gen2) {
+    MVMGCStats *stats = tc->instance->gc_stats;
+    MVMGen2LargeObjects *large = gen2->large;
+    MVMuint64 large_bytes = 0;
+    MVMuint32 bin, i;
+
+    for (bin = 0; bin < MVM_GEN2_BINS; bin++)
+        if (gen2->size_classes[bin].num_pages)
+            MVM_atomic_add(&stats->gen2_class_bytes[bin], (AO_t)gen2->size_classes[bin].num_pages
+                * ((bin + 1) << MVM_GEN2_BIN_BITS) * MVM_GEN2_PAGE_ITEMS);
+    for (i = 0; i < large->num_objects; i++)
+        large_bytes += MVM_GEN2_LARGE_HEADER(large->objects[i])->region_size;
+    MVM_atomic_add(&stats->gen2_large_bytes, (AO_t)large_bytes);
+}
+
+/* Writes a line about a GC run to the log, made of space separated name=value
+ * pairs so it's easy to take apart. Called by the thread that coordinated the
+ * run, once it's done with it; by then, the next run may have started, so
+ * what is known about this one is passed in. The byte counts are those known
+ * at the time, which for a full collection may not yet include all the
+ * threads. The kind of run is one of nursery, marking (a nursery run during
+ * a concurrent marking cycle), full or remark. */
+void MVM_gc_stats_log_run(MVMThreadContext *tc, MVMuint32 seq_number, const char *kind,
+        MVMuint32 num_threads, MVMuint64 pause_us, MVMuint64 wait_us) {
+    MVMInstance *i = tc->instance;
+    MVMGCStats *stats = i->gc_stats;
+    fprintf(stats->log,
+        "gc run=%u time_us=%llu kind=%s threads=%u pause_us=%llu wait_us=%llu"
+        " promoted_bytes=%llu gen2_live_bytes=%llu nursery_runs=%llu full_runs=%llu stolen_threads=%llu\n",
+        seq_number, (unsigned long long)apr_time_now(), kind, num_threads,
+        (unsigned long long)pause_us, (unsigned long long)wait_us,
+        (unsigned long long)stats->promoted_bytes, (unsigned long long)i->gc_gen2_live_bytes,
+        (unsigned long long)stats->nursery_runs, (unsigned long long)stats->full_runs,
+        (unsigned long long)stats->stolen_threads);
+    fflush(stats->log);
+}
+
+/* Adds an integer to a hash of statistics. */
+static void put_int(MVMThreadContext *tc, MVMObject *hash, const char *name, MVMint64 value) {
+    MVMString *key;
+    MVMObject *boxed;
+    MVM_gc_root_temp_push(tc, (MVMCollectable **)&hash);
+    key = MVM_string_ascii_decode_nt(tc, tc->instance->VMString, (char *)name);
+    MVM_gc_root_temp_push(tc, (MVMCollectable **)&key);
+    boxed = MVM_repr_box_int(tc, tc->instance->boot_types->BOOTInt, value);
+    MVM_repr_bind_key_boxed(tc, hash, key, boxed);
+    MVM_gc_root_temp_pop_n(tc, 2);
+}
+
+/* Adds an array of integers to a hash of statistics. */
+static void put_ints(MVMThreadContext *tc, MVMObject *hash, const char *name, AO_t *values, MVMuint32 num) {
+    MVMString *key;
+    MVMObject *array;
+    MVMuint32 i;
+    MVM_gc_root_temp_push(tc, (MVMCollectable **)&hash);
+    key = MVM_string_ascii_decode_nt(tc, tc->instance->VMString, (char *)name);
+    MVM_gc_root_temp_push(tc, (MVMCollectable **)&key);
+    array = MVM_repr_alloc_init(tc, tc->instance->boot_types->BOOTIntArray);
+    MVM_gc_root_temp_push(tc, (MVMCollectable **)&array);
+    for (i = 0; i < num; i++)
+        MVM_repr_push_i(tc, array, (MVMint64)values[i]);
+    MVM_repr_bind_key_boxed(tc, hash, key, array);
+    MVM_gc_root_temp_pop_n(tc, 3);
+}
+
+/* Gives a hash with the GC statistics. The pause histogram and the size
+ * class bytes are integer arrays, indexed by bucket and by size class. */
+MVMObject * MVM_gc_stats_get(MVMThreadContext *tc) {
+    MVMGCStats *stats = tc->instance->gc_stats;
+    MVMObject *hash = MVM_repr_alloc_init(tc, tc->instance->boot_types->BOOTHash);
+    MVM_gc_root_temp_push(tc, (MVMCollectable **)&hash);
+    put_int(tc, hash, "nursery_runs", stats->nursery_runs);
+    put_int(tc, hash, "full_runs", stats->full_runs);
+    put_int(tc, hash, "promoted_bytes", stats->promoted_bytes);
+    put_int(tc, hash, "gen2_live_bytes", tc->instance->gc_gen2_live_bytes);
+    put_int(tc, hash, "gen2_large_bytes", stats->gen2_large_bytes);
+    put_int(tc, hash, "pause_total_us", stats->pause_total_us);
+    put_int(tc, hash, "pause_max_us", stats->pause_max_us);
+    put_int(tc, hash, "finish_wait_us", stats->finish_wait_us);
+    put_int(tc, hash, "stolen_threads", stats->stolen_threads);
+    put_ints(tc, hash, "pauses", stats->pauses, MVM_GC_PAUSE_BUCKETS);
+    put_ints(tc, hash, "gen2_class_bytes", stats->gen2_class_bytes, MVM_GEN2_BINS);
+    MVM_gc_root_temp_pop(tc);
+    return hash;
+}
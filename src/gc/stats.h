@@ -0,0 +1,47 @@
+/* The number of buckets in the histogram of GC pause times. Bucket n counts
+ * pauses of at least 2^n microseconds and under 2^(n+1); the first also
+ * takes the shorter ones, and the last the longer ones. */
+#define MVM_GC_PAUSE_BUCKETS 20
+
+/* Statistics about garbage collection, kept for the instance. All but the
+ * size class bytes only ever go up, so a tool can chart them by taking the
+ * difference between two readings. */
+struct MVMGCStats {
+    /* The number of GC runs that only collected the nurseries, and those
+     * that collected the second generation too. */
+    AO_t nursery_runs;
+    AO_t full_runs;
+
+    /* Bytes promoted to the second generation over all runs. */
+    AO_t promoted_bytes;
+
+    /* Pauses, each being the time a thread spent in a GC run, from when it
+     * entered it to when it could go on running: a histogram of them, their
+     * total and the longest. */
+    AO_t pauses[MVM_GC_PAUSE_BUCKETS];
+    AO_t pause_total_us;
+    AO_t pause_max_us;
+
+    /* Time threads spent waiting for the others to finish a run. */
+    AO_t finish_wait_us;
+
+    /* The number of times a thread that could not take part in a run (as
+     * it was blocked or had exited) had its collection done by another. */
+    AO_t stolen_threads;
+
+    /* The bytes in the pages of each second generation size class, and in
+     * the regions of its large objects, as of the last full collection. */
+    AO_t gen2_class_bytes[MVM_GEN2_BINS];
+    AO_t gen2_large_bytes;
+
+    /* Where a line about each GC run is written, if anywhere. */
+    FILE *log;
+};
+
+/* Functions. */
+void MVM_gc_stats_start_run(MVMThreadContext *tc, MVMuint8 gen);
+void MVM_gc_stats_record_pause(MVMThreadContext *tc, MVMuint64 pause_us, MVMuint64 wait_us);
+void MVM_gc_stats_add_gen2(MVMThreadContext *tc, MVMGen2Allocator *gen2);
+void MVM_gc_stats_log_run(MVMThreadContext *tc, MVMuint32 seq_number, const char *kind,
+    MVMuint32 num_threads, MVMuint64 pause_us, MVMuint64 wait_us);
+MVMObject * MVM_gc_stats_get(MVMThreadContext *tc);
@@ -1,13 +1,120 @@
 #include <moarvm.h>
 
+/* Tells whether a collectable keeps a card table. An object allocated
+ * straight into gen2 hits the barrier as its STable is set, so may not have
+ * one yet. */
+#define HAS_CARDS(c) (!((c)->flags & (MVM_CF_TYPE_OBJECT | MVM_CF_STABLE)) \
+    && STABLE((MVMObject *)(c)) && REPR((MVMObject *)(c))->gc_mark_cards)
+
 /* Called when the write barrier macro detects we need to trigger
  * the write barrier. Arguments are the same as to the barrier macro
  * itself (updating is the object that we're about to write a pointer
  * into, and referenced is the object that the pointer references).
  * This barrier forces a re-scan of the object's contents during a GC
  * run - even a nursery only one - since somewhere it has references
- * to a nursery object. */
+ * to a nursery object. For an object with a card table, that means
+ * every card is scanned at the next run, after which only those that
+ * still point into the nursery stay dirty. */
 void MVM_gc_write_barrier_hit(MVMThreadContext *tc, MVMCollectable *update_root) {
     if (!(update_root->flags & MVM_CF_IN_GEN2_ROOT_LIST))
         MVM_gc_root_gen2_add(tc, update_root);
+    if (HAS_CARDS(update_root))
+        update_root->flags |= MVM_CF_SCAN_ALL_CARDS;
+}
+
+/* Called by the card marking write barrier, when a nursery object is stored
+ * in the given slot of an object with a card table. Dirties the card, and
+ * makes sure the object is in the gen2 roots, so its dirty cards will be
+ * scanned. */
+void MVM_gc_card_mark(MVMThreadContext *tc, MVMCollectable *update_root, MVMGCCardTable **cards, MVMuint64 slot) {
+    MVMuint64 card = slot >> MVM_GC_CARD_BITS;
+    MVM_gc_card_table_ensure(tc, cards, card + 1)->dirty[card] = 1;
+    if (!(update_root->flags & MVM_CF_IN_GEN2_ROOT_LIST))
+        MVM_gc_root_gen2_add(tc, update_root);
+}
+
+/* Called when the slots of an object with a card table move around, so the
+ * cards no longer say where its references to nursery objects are. If it is
+ * not in the gen2 roots it has none, and so there's nothing to do; if it is,
+ * we have every card scanned at the next run. */
+void MVM_gc_card_mark_all(MVMThreadContext *tc, MVMCollectable *update_root) {
+    if (update_root->flags & MVM_CF_IN_GEN2_ROOT_LIST)
+        update_root->flags |= MVM_CF_SCAN_ALL_CARDS;
+}
+
+/* Makes sure a card table covers at least the given number of cards, making
+ * it if there isn't one yet. Any new cards are clean. */
+MVMGCCardTable * MVM_gc_card_table_ensure(MVMThreadContext *tc, MVMGCCardTable **cards, MVMuint64 num_cards) {
+    MVMGCCardTable *table = *cards;
+    if (!table) {
+        table = *cards = malloc(sizeof(MVMGCCardTable));
+        table->num_cards = 0;
+        table->dirty     = NULL;
+    }
+    if (table->num_cards < num_cards) {
+        MVMuint64 new_num = table->num_cards ? table->num_cards : 1;
+        while (new_num < num_cards)
+            new_num *= 2;
+        table->dirty = realloc(table->dirty, new_num);
+        memset(table->dirty + table->num_cards, 0, new_num - table->num_cards);
+        table->num_cards = new_num;
+    }
+    return table;
+}
+
+/* Marks the dirty cards of a buffer of slots, for the slots from the index
+ * from up to (but not including) the index to; those outside of that are
+ * not in use. If all is set, every card is taken to be dirty. Each card we
+ * look at stays dirty only if it still holds a reference to a nursery
+ * object. Returns non-zero if any card is still dirty. */
+MVMuint32 MVM_gc_card_mark_slots(MVMThreadContext *tc, MVMGCCardTable **cards, MVMCollectable **slots,
+        MVMuint64 from, MVMuint64 to, MVMuint32 all, MVMGCWorklist *worklist) {
+    MVMGCCardTable *table;
+    MVMuint64       card, first_card, end_card;
+    MVMuint32       any_dirty = 0;
+
+    if (from >= to) {
+        if (*cards)
+            memset((*cards)->dirty, 0, (*cards)->num_cards);
+        return 0;
+    }
+    first_card = from >> MVM_GC_CARD_BITS;
+    end_card   = ((to - 1) >> MVM_GC_CARD_BITS) + 1;
+    table      = MVM_gc_card_table_ensure(tc, cards, end_card);
+
+    /* Cards that cover no slots in use need never be looked at again. */
+    memset(table->dirty, 0, first_card);
+    memset(table->dirty + end_card, 0, table->num_cards - end_card);
+
+    for (card = first_card; card < end_card; card++) {
+        MVMuint64 i, limit;
+        MVMuint8  dirty = 0;
+        if (!all && !table->dirty[card])
+            continue;
+        i     = card << MVM_GC_CARD_BITS;
+        limit = i + MVM_GC_CARD_SIZE;
+        if (i < from)
+            i = from;
+        if (limit > to)
+            limit = to;
+        for (; i < limit; i++) {
+            MVMCollectable *c = slots[i];
+            if (c && !(c->flags & MVM_CF_SECOND_GEN)) {
+                MVM_gc_worklist_add(tc, worklist, &slots[i]);
+                dirty = 1;
+            }
+        }
+        table->dirty[card] = dirty;
+        any_dirty |= dirty;
+    }
+    return any_dirty;
+}
+
+/* Frees a card table, if there is one. */
+void MVM_gc_card_table_free(MVMThreadContext *tc, MVMGCCardTable **cards) {
+    if (*cards) {
+        free((*cards)->dirty);
+        free(*cards);
+        *cards = NULL;
+    }
 }
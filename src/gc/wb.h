@@ -1,11 +1,17 @@
 /* Ensures that if a generation 2 object comes to hold a reference to a
- * nursery object, then it is added to the  */
+ * nursery object, then it is added to the gen2 roots. While the second
+ * generation is being marked concurrently, a reference to another gen2
+ * object it comes to hold is greyed, so the marker can't miss it. */
 #define MVM_WB(tc, update_root, referenced) \
     { \
         MVMCollectable *u = (MVMCollectable *)update_root; \
         MVMCollectable *r = (MVMCollectable *)referenced; \
-        if (((u->flags & MVM_CF_SECOND_GEN) && r && !(r->flags & MVM_CF_SECOND_GEN))) \
-            MVM_gc_write_barrier_hit(tc, u); \
+        if ((u->flags & MVM_CF_SECOND_GEN) && r) { \
+            if (!(r->flags & MVM_CF_SECOND_GEN)) \
+                MVM_gc_write_barrier_hit(tc, u); \
+            else if ((tc)->instance->gc_marking) \
+                MVM_gc_concurrent_grey(tc, r); \
+        } \
     }
 
 /* Does an assignment, but makes sure the write barrier MVM_WB is applied
@@ -19,6 +25,44 @@
         update_addr = _r; \
     }
 
+/* Large aggregates (arrays and hashes) split their storage into cards of
+ * MVM_GC_CARD_SIZE slots, and keep a table of which cards may hold a
+ * reference to a nursery object. A nursery collection then only has to
+ * look at the dirty cards of such an object, not all of it. */
+#define MVM_GC_CARD_BITS    6
+#define MVM_GC_CARD_SIZE    (1 << MVM_GC_CARD_BITS)
+
+struct MVMGCCardTable {
+    /* The number of cards the table covers. */
+    MVMuint64  num_cards;
+
+    /* A byte per card; non-zero if the card is dirty. */
+    MVMuint8  *dirty;
+};
+
+/* Does an assignment into the given slot of an object with a card table.
+ * The write barrier dirties the card with the slot in it, rather than the
+ * whole object. */
+#define MVM_ASSIGN_REF_CARD(tc, update_root, cards, slot, update_addr, referenced) \
+    { \
+        void *_r = referenced; \
+        MVMCollectable *_u = (MVMCollectable *)update_root; \
+        if ((_u->flags & MVM_CF_SECOND_GEN) && _r) { \
+            if (!(((MVMCollectable *)_r)->flags & MVM_CF_SECOND_GEN)) \
+                MVM_gc_card_mark(tc, _u, cards, slot); \
+            else if ((tc)->instance->gc_marking) \
+                MVM_gc_concurrent_grey(tc, (MVMCollectable *)_r); \
+        } \
+        update_addr = _r; \
+    }
+
 /* Functions for if the write barriers are hit. */
 void MVM_gc_write_barrier_hit(MVMThreadContext *tc, MVMCollectable *update_root);
+void MVM_gc_card_mark(MVMThreadContext *tc, MVMCollectable *update_root, MVMGCCardTable **cards, MVMuint64 slot);
+void MVM_gc_card_mark_all(MVMThreadContext *tc, MVMCollectable *update_root);
 
+/* Functions for card tables. */
+MVMGCCardTable * MVM_gc_card_table_ensure(MVMThreadContext *tc, MVMGCCardTable **cards, MVMuint64 num_cards);
+MVMuint32 MVM_gc_card_mark_slots(MVMThreadContext *tc, MVMGCCardTable **cards, MVMCollectable **slots,
+    MVMuint64 from, MVMuint64 to, MVMuint32 all, MVMGCWorklist *worklist);
+void MVM_gc_card_table_free(MVMThreadContext *tc, MVMGCCardTable **cards);
@@ -11,18 +11,36 @@ int main(int argc, const char *argv[]) {
            Otherwise, use a character such as 'h' */
         { "dump", 256, 0, "dump bytecode" },
         { "help", 257, 0, "show help" },
+        { "profile-ops", 258, 0, "profile op execution" },
         { NULL, 0, 0, NULL }
     };
     apr_getopt_t *opt;
     int optch;
     const char *optarg;
     int dump = 0;
+    int profile_ops = 0;
     char *input_file;
     int exitcode = 0;
     const char *helptext = "\
     MoarVM usage: moarvm [options] bytecode.moarvm [program args]           \n\
       --help, display this message                                          \n\
-      --dump, dump the bytecode to stdout instead of executing              \n";
+      --dump, dump the bytecode to stdout instead of executing              \n\
+      --profile-ops, count the ops executed and report on them to stderr    \n\
+                     at exit; setting MVM_PROFILE_OPS does the same         \n\
+                                                                            \n\
+    Environment variables for tuning the garbage collector:                 \n\
+      MVM_GC_NURSERY_SIZE, the size each thread's nursery starts out at     \n\
+                           (such as 512K or 4M; default 2M)                 \n\
+      MVM_GC_NURSERY_MAX_SIZE, the largest a nursery may grow to when       \n\
+                           little survives its collections (default 32M)    \n\
+      MVM_GC_GEN2_GROWTH, the percentage by which the old generation may    \n\
+                           grow before it is collected (default 50)         \n\
+      MVM_GC_CONCURRENT_MARK, set to 1 to mark the old generation in slices \n\
+                           between GC runs rather than all at once          \n\
+      MVM_GC_DEFRAG, set to 1 to have full collections move what lives in   \n\
+                           the emptiest old generation pages elsewhere, and \n\
+                           free those pages                                 \n\
+      MVM_GC_LOG, a file to append a line about each GC run to              \n";
     int processed_args = 0;
 
     instance = MVM_vm_create_instance();
@@ -37,6 +55,9 @@ int main(int argc, const char *argv[]) {
         case 257:
             printf("%s", helptext);
             goto terminate;
+        case 258:
+            profile_ops = 1;
+            break;
         }
     }
     processed_args = opt->ind;
@@ -55,6 +76,8 @@ int main(int argc, const char *argv[]) {
         MVM_vm_dump_file(instance, input_file);
     }
     else {
+        if (profile_ops || getenv("MVM_PROFILE_OPS"))
+            MVM_op_profile_start(instance);
         MVM_vm_run_file(instance, input_file);
     }
 
@@ -9,11 +9,33 @@
 	} \
 } while (0)
 
+/* Reads a GC tuning setting from the environment, falling back to the given
+ * default if it's not set. Sizes may have a K, M or G suffix. */
+static MVMuint32 gc_setting(const char *name, MVMuint32 default_value) {
+    const char *value = getenv(name);
+    char *end;
+    unsigned long long result;
+    if (!value || !*value)
+        return default_value;
+    result = strtoull(value, &end, 10);
+    switch (*end) {
+        case 'k': case 'K': result <<= 10; end++; break;
+        case 'm': case 'M': result <<= 20; end++; break;
+        case 'g': case 'G': result <<= 30; end++; break;
+    }
+    if (*end || end == value || result > 0xFFFFFFFFULL) {
+        fprintf(stderr, "MoarVM: Invalid value '%s' for %s; ignoring it\n", value, name);
+        return default_value;
+    }
+    return (MVMuint32)result;
+}
+
 /* Create a new instance of the VM. */
 static void string_consts(MVMThreadContext *tc);
 MVMInstance * MVM_vm_create_instance(void) {
     MVMInstance *instance;
     apr_status_t apr_init_stat;
+    const char  *gc_log;
 
     /* Set up APR related bits. */
     apr_init_stat = apr_initialize();
@@ -36,12 +58,34 @@ MVMInstance * MVM_vm_create_instance(void) {
         exit(1);
     }
 
+    /* Set up GC tuning, which the environment may override. This must be
+     * done before any thread contexts, with their nurseries, are made. */
+    instance->gc_nursery_size     = gc_setting("MVM_GC_NURSERY_SIZE", MVM_NURSERY_SIZE);
+    instance->gc_nursery_max_size = gc_setting("MVM_GC_NURSERY_MAX_SIZE", MVM_NURSERY_MAX_SIZE);
+    instance->gc_gen2_growth      = gc_setting("MVM_GC_GEN2_GROWTH", MVM_GC_GEN2_GROWTH);
+    instance->gc_concurrent_mark  = gc_setting("MVM_GC_CONCURRENT_MARK", 0) != 0;
+    instance->gc_defrag           = gc_setting("MVM_GC_DEFRAG", 0) != 0;
+    if (instance->gc_nursery_size < MVM_NURSERY_MIN_SIZE)
+        instance->gc_nursery_size = MVM_NURSERY_MIN_SIZE;
+    if (instance->gc_nursery_max_size < instance->gc_nursery_size)
+        instance->gc_nursery_max_size = instance->gc_nursery_size;
+
+    /* Set up GC statistics, and the log of GC runs if one was asked for. */
+    instance->gc_stats = calloc(1, sizeof(MVMGCStats));
+    gc_log = getenv("MVM_GC_LOG");
+    if (gc_log && *gc_log) {
+        instance->gc_stats->log = fopen(gc_log, "a");
+        if (!instance->gc_stats->log)
+            fprintf(stderr, "MoarVM: Unable to open GC log '%s'; ignoring it\n", gc_log);
+    }
+
     /* Create the main thread's ThreadContext and stash it. */
     instance->main_thread = MVM_tc_create(instance);
 
     /* No user threads when we start, and next thread to be created gets ID 1
      * (the main thread got ID 0). */
     instance->num_user_threads    = 0;
+    instance->frames_shared       = 0;
     instance->next_user_thread_id = 1;
 
     /* Set up the permanent roots storage. */
@@ -50,6 +94,16 @@ MVMInstance * MVM_vm_create_instance(void) {
     instance->permroots       = malloc(sizeof(MVMCollectable **) * instance->alloc_permroots);
     init_mutex(instance->mutex_permroots, "permanent roots");
 
+    /* Set up the mutex and condition that idle collecting threads wait on. */
+    init_mutex(instance->mutex_gc_progress, "GC progress");
+    init_mutex(instance->mutex_gc_foreign_grey, "GC foreign grey objects");
+    if ((apr_init_stat = apr_thread_cond_create(&instance->cond_gc_progress, instance->apr_pool)) != APR_SUCCESS) {
+        char error[256];
+        fprintf(stderr, "MoarVM: Initialization of GC progress condition failed\n    %s\n",
+            apr_strerror(apr_init_stat, error, 256));
+        exit(1);
+    }
+
     /* Set up HLL config mutex. */
     init_mutex(instance->mutex_hllconfigs, "hll configs");
 
@@ -59,6 +113,10 @@ MVMInstance * MVM_vm_create_instance(void) {
     /* Set up container registry mutex. */
     init_mutex(instance->mutex_container_registry, "container registry");
 
+    /* Set up the callsite intern table and its mutex. */
+    instance->callsite_interns = calloc(1, sizeof(MVMCallsiteInterns));
+    init_mutex(instance->mutex_callsite_interns, "callsite interns");
+
     /* Bootstrap 6model. It is assumed the GC will not be called during this. */
     MVM_6model_bootstrap(instance->main_thread);
 
@@ -161,10 +219,25 @@ void MVM_vm_destroy_instance(MVMInstance *instance) {
     /* Destroy main thread contexts. */
     MVM_tc_destroy(instance->main_thread);
 
+    /* Report on the ops executed, if we were profiling them. */
+    if (instance->op_profile) {
+        MVM_op_profile_report(instance);
+        MVM_op_profile_destroy(instance);
+    }
+
     /* Clean up GC permanent roots related resources. */
     apr_thread_mutex_destroy(instance->mutex_permroots);
     free(instance->permroots);
 
+    /* Clean up what's left over from concurrent marking. */
+    apr_thread_mutex_destroy(instance->mutex_gc_foreign_grey);
+    free(instance->gc_foreign_grey);
+
+    /* Clean up GC statistics. */
+    if (instance->gc_stats->log)
+        fclose(instance->gc_stats->log);
+    free(instance->gc_stats);
+
     /* Free APR pool. */
     apr_pool_destroy(instance->apr_pool);
 
@@ -12,6 +12,7 @@
 #include <apr_portable.h>
 #include <apr_env.h>
 #include <apr_getopt.h>
+#include <apr_thread_cond.h>
 
 /* libatomic_ops */
 #include <atomic_ops.h>
@@ -33,7 +34,10 @@
 #include "core/args.h"
 #include "core/exceptions.h"
 #include "core/frame.h"
+#include "core/callstack.h"
 #include "core/validation.h"
+#include "core/predecode.h"
+#include "core/opprofile.h"
 #include "core/compunit.h"
 #include "core/bytecode.h"
 #include "core/bytecodedump.h"
@@ -55,6 +59,9 @@
 #include "gc/gen2.h"
 #include "gc/roots.h"
 #include "gc/wb.h"
+#include "gc/concurrent.h"
+#include "gc/stats.h"
+#include "gc/snapshot.h"
 #include "strings/ascii.h"
 #include "strings/utf8.h"
 #include "strings/ops.h"
@@ -1,14 +1,9 @@
 #include "moarvm.h"
 
 /*  TODO:
-- add a tunable global determining at what depth it should
-    start flattening.  Write a rope-tree-flattening function
-    (not like string_flatten) that puts all the sub strands
-    in one MVMStrand array.
-    (optimization)
 - add a tunable global determining under which size result
     string should it just do the old copying behavior, for
-    join, concat, split, and repeat.
+    join, split, and repeat (concat does it already).
     This might be related to MVMString object size?
     (optimization)
 - make the uc, lc, tc functions intelligently
@@ -49,7 +44,7 @@ MVMuint8 MVM_string_traverse_substring(MVMThreadContext *tc, MVMString *a, MVMSt
                 /* call ourself on the sub-strand */
                 return_val = MVM_string_traverse_substring(tc, strand->string,
                     index - strand->compare_offset + strand->string_offset,
-                    substring_length, top_index + index, consumer, data);
+                    substring_length, top_index + index - start, consumer, data);
                 /* if we've been instructed to, abort early */
                 if (return_val)
                     return return_val;
@@ -73,27 +68,6 @@ MVMuint8 MVM_string_traverse_substring(MVMThreadContext *tc, MVMString *a, MVMSt
     MVM_exception_throw_adhoc(tc, "internal string corruption");
 }
 
-/* stack record created with each invocation of the string descent. */
-typedef struct CompareCursor {
-    MVMString *string; /* string into which descended */
-    struct CompareCursor *parent; /* parent cursor */
-    MVMint16 *gaps; /* number of gaps can ascend */
-    MVMStringIndex string_idx; /* in string, not strand */
-    MVMStringIndex end_idx; /* index past last codepoint needed */
-    MVMStrandIndex strand_idx; /* current strand index */
-    MVMuint8 owns_buffer; /* whether it owns the last buffer.
-            for ropes, whether it's uninitialized. */
-    MVMuint8 isa; /* whether it's from string tree a */
-} CompareCursor;
-
-typedef struct {
-    CompareCursor *cursora, *cursorb; /* cursors */
-    MVMCodepoint32 *int32s; /* last physical string's buffer */
-    MVMCodepoint8 *uint8s; /* last physical string's buffer */
-    MVMStringIndex available; /* number of codepoints in the buffer */
-    MVMStringIndex needed; /* number of codepoints still needed */
-} CompareDescentState;
-
 /* uses the computed binary search table to find the strand containing the index */
 static MVMStrandIndex find_strand_index(MVMString *s, MVMStringIndex index) {
     MVMStrand *strands = s->body.strands;
@@ -107,140 +81,6 @@ static MVMStrandIndex find_strand_index(MVMString *s, MVMStringIndex index) {
     }
 }
 
-#define descend_sized_chew_success(member, other_member) \
-st->needed -= tocompare; \
-if (!st->needed) { \
-    *result = 2; \
-    return; \
-} \
-else if (wehave > tocompare) { \
-    st->member = c->string->body.member + c->string_idx + tocompare; \
-    st->available = wehave - tocompare; \
-    c->owns_buffer = 1; \
-    st->other_member = NULL; \
-} \
-else { \
-    st->other_member += tocompare; \
-    st->available -= tocompare; \
-} \
-
-#define descend_sized(member, other_member, size, other_size, cp, other_cp) \
-MVMStringIndex wehave = c->end_idx - c->string_idx; \
-if (st->available) { \
-    MVMStringIndex tocompare = st->available < wehave ? st->available : wehave; \
-    if (st->member) { \
-        if (memcmp(st->member, c->string->body.member + c->string_idx, \
-               wehave * sizeof(size))) { \
-            *result = 1; \
-            return; \
-        } \
-        descend_sized_chew_success(member, other_member) \
-    } \
-    else { \
-        size \
-            *cp = c->string->body.member + c->string_idx, \
-            *final = cp + tocompare; \
-        other_size *other_cp = st->other_member; \
-        for (; cp < final; ) { \
-            if (*cp32++ != (MVMCodepoint32) *cp8++) { \
-                *result = 1; \
-                return; \
-            } \
-        } \
-        descend_sized_chew_success(other_member, member) \
-    } \
-    if (c->isa) { st->cursora = c->parent; } \
-    else { st->cursorb = c->parent; } \
-    return; \
-} \
-st->member = c->string->body.member + c->string_idx; \
-st->other_member = NULL; \
-st->available = wehave; \
-c->owns_buffer = 1; \
-continue;
-
-/* If a is composed of strands, create a descent record, initialize it, and
- * descend into the substring. If result is set when it returns, return.
- * If a is a real string, grab some codepoints from a string, compare
- * with codepoints from the other buffer. If different, set result nonzero and
- * it will fast return. Otherwise, reset buffer indexes
- * to zero. Loop if `needed` for the current string is nonzero. */
-static void compare_descend(MVMThreadContext *tc, CompareDescentState *st,
-        MVMuint8 *result, CompareCursor *orig) {
-    /* while we still need to compare some things */
-    while (st->needed) {
-        /* pick a tree from which to get more characters. */
-        CompareCursor *c = st->cursora->owns_buffer ? st->cursorb : st->cursora;
-
-        if (*c->gaps) {
-            (*c->gaps)--;
-            if (c->isa) { st->cursora = c->parent; }
-            else { st->cursorb = c->parent; }
-            return;
-        }
-
-        /* get some characters, comparing as they're found */
-        switch(STR_FLAGS(c->string)) {
-            case MVM_STRING_TYPE_INT32: {
-                descend_sized(int32s, uint8s, MVMCodepoint32, MVMCodepoint8, cp32, cp8)
-            }
-            case MVM_STRING_TYPE_UINT8: {
-                descend_sized(uint8s, int32s, MVMCodepoint8, MVMCodepoint32, cp8, cp32)
-            }
-            case MVM_STRING_TYPE_ROPE: {
-                MVMStrand *strand;
-                MVMStringIndex next_compare_offset, child_length, child_idx, child_end_idx;
-                if (c->owns_buffer) { /* first time we've seen this rope */
-                    c->strand_idx = find_strand_index(c->string, c->string_idx);
-                    c->owns_buffer = 0;
-                }
-                if (c->string_idx == c->end_idx) {
-                    if (c->isa) { st->cursora = c->parent; }
-                    else { st->cursorb = c->parent; }
-                    if (orig == c)
-                        return;
-                    (*c->gaps)++;
-                    continue;
-                }
-                strand = c->string->body.strands + c->strand_idx;
-                child_idx = c->string_idx - strand->compare_offset;
-                next_compare_offset = (strand + 1)->compare_offset;
-                child_length = next_compare_offset - strand->compare_offset;
-                child_length = child_length > c->end_idx - c->string_idx
-                    ? c->end_idx - c->string_idx : child_length;
-                child_end_idx = child_idx + child_length;
-                c->string_idx += child_length;
-                c->strand_idx++;
-                {
-                    CompareCursor child = { strand->string, c, c->gaps, child_idx,
-                        child_end_idx, 0, IS_ROPE(strand->string), c->isa };
-                    if (c->isa) { st->cursora = &child; } else { st->cursorb = &child; }
-                    compare_descend(tc, st, result, &child);
-                }
-                if (*result) return;
-                continue;
-            }
-            default:
-                MVM_exception_throw_adhoc(tc, "internal string corruption");
-        }
-    }
-    *result = 2;
-}
-
-/* returns nonzero if two substrings are equal, doesn't check bounds */
-MVMint64 MVM_string_substrings_equal_nocheck(MVMThreadContext *tc, MVMString *a,
-        MVMint64 starta, MVMint64 length, MVMString *b, MVMint64 startb) {
-    MVMint16 gapsa = 0, gapsb = 0;
-    MVMuint8 result = 0;
-    CompareCursor
-        cursora = { a, NULL, &gapsa, starta, starta + length, 0, IS_ROPE(a), 1 },
-        cursorb = { b, NULL, &gapsb, startb, startb + length, 0, IS_ROPE(b), 0 };
-    CompareDescentState st = { &cursora, &cursorb, NULL, NULL, 0, length };
-
-    compare_descend(tc, &st, &result, &cursora);
-    return result ? result - 1 : 1;
-}
-
 /* returns the codepoint without doing checks, for internal VM use only. */
 MVMCodepoint32 MVM_string_get_codepoint_at_nocheck(MVMThreadContext *tc, MVMString *a, MVMint64 index) {
     MVMStringIndex idx = (MVMStringIndex)index;
@@ -260,10 +100,360 @@ MVMCodepoint32 MVM_string_get_codepoint_at_nocheck(MVMThreadContext *tc, MVMStri
     return 0;
 }
 
+/* A run of codepoints in a flat string, and where it goes in the text
+ * being searched. */
+typedef struct {
+    MVMString *string;
+    MVMStringIndex start;     /* where the run starts in the string */
+    MVMStringIndex top_index; /* where it starts in the text */
+    MVMStringIndex end_index; /* where it ends in the text */
+} SearchRun;
+
+/* A part of a string that is being searched, seen as the runs of the flat
+ * strings it's made of, so that a rope can be searched without flattening
+ * it. If reverse is set, the text is seen back to front, which is how the
+ * searches from the end are done. */
+typedef struct {
+    SearchRun *runs;
+    MVMuint32 num_runs;
+    MVMuint32 alloc_runs;
+    MVMuint32 current;     /* the run last looked in */
+    MVMuint8 reverse;
+    MVMStringIndex length;
+    SearchRun one_run;     /* the only run, if the string is flat */
+} SearchText;
+
+/* A string being searched for, copied out as codepoints, along with its
+ * critical factorization for the Two-Way algorithm: the needle splits into
+ * the codepoints before critical and those from it on. If the needle is
+ * periodic, memory is how much of it is still known to match when it is
+ * moved on by its period; otherwise it's 0 and the period is how far to
+ * move it when the part before critical doesn't match. */
+typedef struct {
+    MVMCodepoint32 *codepoints;
+    MVMStringIndex length;
+    MVMStringIndex critical;
+    MVMStringIndex period;
+    MVMStringIndex memory;
+} SearchNeedle;
+
+/* adds a run to a search text. */
+static MVM_SUBSTRING_CONSUMER(search_run_consumer) {
+    SearchText *text = (SearchText *)data;
+    SearchRun *run;
+    if (!length)
+        return 0;
+    if (text->num_runs == text->alloc_runs) {
+        text->alloc_runs *= 2;
+        text->runs = realloc(text->runs, text->alloc_runs * sizeof(SearchRun));
+    }
+    run = text->runs + text->num_runs++;
+    run->string = string;
+    run->start = start;
+    run->top_index = top_index;
+    run->end_index = top_index + length;
+    return 0;
+}
+
+/* Sets up a search of length codepoints of s, from start. Nothing in it is
+ * rooted, so it must be done with before anything is allocated. */
+static void search_text_init(MVMThreadContext *tc, SearchText *text, MVMString *s,
+        MVMStringIndex start, MVMStringIndex length, MVMuint8 reverse) {
+    text->current = 0;
+    text->reverse = reverse;
+    text->length = length;
+    if (IS_ROPE(s)) {
+        text->num_runs = 0;
+        text->alloc_runs = 8;
+        text->runs = malloc(text->alloc_runs * sizeof(SearchRun));
+        MVM_string_traverse_substring(tc, s, start, length, 0, search_run_consumer, text);
+    }
+    else {
+        text->one_run.string = s;
+        text->one_run.start = start;
+        text->one_run.top_index = 0;
+        text->one_run.end_index = length;
+        text->runs = &text->one_run;
+        text->num_runs = text->alloc_runs = 1;
+    }
+}
+
+static void search_text_destroy(SearchText *text) {
+    if (text->runs != &text->one_run)
+        free(text->runs);
+}
+
+/* Finds the run with the codepoint at index (counting from the start of the
+ * part of the string, whatever the direction). Searches mostly look near
+ * where they last did, so the run last used is tried first. */
+static SearchRun * search_run_at(SearchText *text, MVMStringIndex index) {
+    SearchRun *run = text->runs + text->current;
+    MVMuint32 lower, upper;
+    if (index >= run->top_index && index < run->end_index)
+        return run;
+    lower = 0;
+    upper = text->num_runs;
+    while (upper - lower > 1) {
+        MVMuint32 middle = lower + (upper - lower) / 2;
+        *(index >= text->runs[middle].top_index ? &lower : &upper) = middle;
+    }
+    text->current = lower;
+    return text->runs + lower;
+}
+
+/* Gets the codepoint at a position in the text. */
+static MVMCodepoint32 search_text_at(SearchText *text, MVMStringIndex pos) {
+    SearchRun *run;
+    if (text->reverse)
+        pos = text->length - 1 - pos;
+    run = search_run_at(text, pos);
+    pos = pos - run->top_index + run->start;
+    return IS_WIDE(run->string)
+        ? run->string->body.int32s[pos]
+        : (MVMCodepoint32)run->string->body.uint8s[pos];
+}
+
+/* Tells whether n codepoints of two flat strings differ, from ai in a and
+ * bi in b. */
+static MVMuint8 runs_differ(MVMString *a, MVMStringIndex ai, MVMString *b,
+        MVMStringIndex bi, MVMStringIndex n) {
+    MVMCodepoint32 *wide;
+    MVMCodepoint8 *narrow;
+    MVMStringIndex k;
+    if (IS_WIDE(a) && IS_WIDE(b))
+        return memcmp(a->body.int32s + ai, b->body.int32s + bi, n * sizeof(MVMCodepoint32)) != 0;
+    if (!IS_WIDE(a) && !IS_WIDE(b))
+        return memcmp(a->body.uint8s + ai, b->body.uint8s + bi, n) != 0;
+    wide = IS_WIDE(a) ? a->body.int32s + ai : b->body.int32s + bi;
+    narrow = IS_WIDE(a) ? b->body.uint8s + bi : a->body.uint8s + ai;
+    for (k = 0; k < n; k++)
+        if (wide[k] != (MVMCodepoint32)narrow[k])
+            return 1;
+    return 0;
+}
+
+/* compares a run of codepoints with those at the same place in the search
+ * text in *data, a run of the text at a time, stopping if they differ. */
+static MVM_SUBSTRING_CONSUMER(compare_consumer) {
+    SearchText *text = (SearchText *)data;
+    while (length) {
+        SearchRun *run = search_run_at(text, top_index);
+        MVMStringIndex n = run->end_index - top_index;
+        if (n > length)
+            n = length;
+        if (runs_differ(string, start, run->string, top_index - run->top_index + run->start, n))
+            return 1;
+        start += n;
+        top_index += n;
+        length -= n;
+    }
+    return 0;
+}
+
+/* returns nonzero if two substrings are equal, doesn't check bounds */
+MVMint64 MVM_string_substrings_equal_nocheck(MVMThreadContext *tc, MVMString *a,
+        MVMint64 starta, MVMint64 length, MVMString *b, MVMint64 startb) {
+    SearchText text;
+    MVMuint8 differ;
+    if (!length)
+        return 1;
+    search_text_init(tc, &text, b, startb, length, 0);
+    differ = MVM_string_traverse_substring(tc, a, starta, length, 0, compare_consumer, &text);
+    search_text_destroy(&text);
+    return !differ;
+}
+
+/* Finds the first position from pos and before limit where the text has the
+ * codepoint cp, going over a run at a time, with memchr for the 8-bit runs;
+ * gives limit if there is none. */
+static MVMStringIndex search_text_find(SearchText *text, MVMStringIndex pos,
+        MVMStringIndex limit, MVMCodepoint32 cp) {
+    MVMStringIndex n, k;
+    if (!text->reverse) {
+        while (pos < limit) {
+            SearchRun *run = search_run_at(text, pos);
+            MVMStringIndex end = run->end_index < limit ? run->end_index : limit;
+            MVMStringIndex i = pos - run->top_index + run->start;
+            n = end - pos;
+            if (IS_WIDE(run->string)) {
+                MVMCodepoint32 *cps = run->string->body.int32s + i;
+                for (k = 0; k < n; k++)
+                    if (cps[k] == cp)
+                        return pos + k;
+            }
+            else if (cp >= 0 && cp < 256) {
+                MVMCodepoint8 *cps = run->string->body.uint8s + i;
+                MVMCodepoint8 *found = memchr(cps, cp, n);
+                if (found)
+                    return pos + (found - cps);
+            }
+            pos = end;
+        }
+    }
+    else {
+        /* Go down through the string from the position pos is at to the
+         * one limit is at, exclusive. */
+        MVMStringIndex lowest = text->length - limit, at = text->length - pos;
+        while (at > lowest) {
+            SearchRun *run = search_run_at(text, at - 1);
+            MVMStringIndex begin = run->top_index > lowest ? run->top_index : lowest;
+            MVMStringIndex i = begin - run->top_index + run->start;
+            n = at - begin;
+            if (IS_WIDE(run->string)) {
+                MVMCodepoint32 *cps = run->string->body.int32s + i;
+                for (k = n; k-- > 0; )
+                    if (cps[k] == cp)
+                        return text->length - 1 - (begin + k);
+            }
+            else if (cp >= 0 && cp < 256) {
+                MVMCodepoint8 *cps = run->string->body.uint8s + i;
+                for (k = n; k-- > 0; )
+                    if (cps[k] == cp)
+                        return text->length - 1 - (begin + k);
+            }
+            at = begin;
+        }
+    }
+    return limit;
+}
+
+/* copies the codepoints of a string into the buffer in *data. */
+static MVM_SUBSTRING_CONSUMER(search_needle_consumer) {
+    MVMCodepoint32 *buffer = (MVMCodepoint32 *)data + top_index;
+    MVMStringIndex i;
+    if (IS_WIDE(string))
+        memcpy(buffer, string->body.int32s + start, length * sizeof(MVMCodepoint32));
+    else
+        for (i = 0; i < length; i++)
+            buffer[i] = string->body.uint8s[start + i];
+    return 0;
+}
+
+/* Finds the start of the maximal suffix of a needle, by the codepoint order
+ * or its opposite, and that suffix's period. */
+static MVMint64 maximal_suffix(MVMCodepoint32 *x, MVMint64 m, MVMuint8 opposite, MVMint64 *period) {
+    MVMint64 i = -1, j = 0, k = 1, p = 1;
+    while (j + k < m) {
+        MVMCodepoint32 a = x[i + k], b = x[j + k];
+        if (a == b) {
+            if (k == p) {
+                j += p;
+                k = 1;
+            }
+            else
+                k++;
+        }
+        else if (opposite ? a < b : a > b) {
+            j += k;
+            k = 1;
+            p = j - i;
+        }
+        else {
+            i = j++;
+            k = p = 1;
+        }
+    }
+    *period = p;
+    return i + 1;
+}
+
+/* Copies out a needle of m codepoints (back to front, for searching from
+ * the end) and works out its critical factorization. */
+static void search_needle_init(MVMThreadContext *tc, SearchNeedle *needle, MVMString *s,
+        MVMStringIndex m, MVMuint8 reverse) {
+    MVMCodepoint32 *x = malloc(m * sizeof(MVMCodepoint32));
+    MVMint64 critical, other, period, other_period;
+    MVM_string_traverse_substring(tc, s, 0, m, 0, search_needle_consumer, x);
+    if (reverse) {
+        MVMStringIndex i;
+        for (i = 0; i < m / 2; i++) {
+            MVMCodepoint32 cp = x[i];
+            x[i] = x[m - 1 - i];
+            x[m - 1 - i] = cp;
+        }
+    }
+    critical = maximal_suffix(x, m, 0, &period);
+    other = maximal_suffix(x, m, 1, &other_period);
+    if (other > critical) {
+        critical = other;
+        period = other_period;
+    }
+    needle->codepoints = x;
+    needle->length = m;
+    needle->critical = critical;
+    if (memcmp(x, x + period, critical * sizeof(MVMCodepoint32)) == 0) {
+        needle->period = period;
+        needle->memory = m - period;
+    }
+    else {
+        MVMint64 right = (MVMint64)m - critical;
+        needle->period = (critical - 1 > right ? critical - 1 : right) + 1;
+        needle->memory = 0;
+    }
+}
+
+/* Finds the first place from pos where the needle is in the text, with the
+ * Two-Way algorithm of Crochemore and Perrin, which takes time linear in
+ * the length of the text however the needle and text repeat themselves.
+ * When nothing is known of where the needle might match, it skips to where
+ * the text has the codepoint at the needle's critical position. Gives -1
+ * if it's not found. */
+static MVMint64 search_text(SearchText *text, SearchNeedle *needle, MVMStringIndex pos) {
+    MVMCodepoint32 *x = needle->codepoints;
+    MVMStringIndex m = needle->length, critical = needle->critical, memory = 0, k;
+    MVMStringIndex last;
+    if (text->length < m)
+        return -1;
+    last = text->length - m;
+    while (pos <= last) {
+        if (!memory) {
+            pos = search_text_find(text, pos + critical, last + critical + 1, x[critical]);
+            if (pos > last + critical)
+                return -1;
+            pos -= critical;
+        }
+        /* Match the part from critical on, left to right. */
+        k = critical > memory ? critical : memory;
+        while (k < m && x[k] == search_text_at(text, pos + k))
+            k++;
+        if (k < m) {
+            pos += k + 1 - critical;
+            memory = 0;
+            continue;
+        }
+        /* Match the part before critical, right to left. */
+        k = critical;
+        while (k > memory && x[k - 1] == search_text_at(text, pos + k - 1))
+            k--;
+        if (k <= memory)
+            return (MVMint64)pos;
+        pos += needle->period;
+        memory = needle->memory;
+    }
+    return -1;
+}
+
+/* Searches for a needle of m codepoints in length codepoints of the
+ * haystack from start, either from the start of them or from the end. */
+static MVMint64 search(MVMThreadContext *tc, MVMString *haystack, MVMStringIndex start,
+        MVMStringIndex length, MVMString *needle, MVMStringIndex m, MVMuint8 reverse) {
+    SearchText text;
+    SearchNeedle sneedle;
+    MVMint64 result;
+    if (length < m)
+        return -1;
+    search_text_init(tc, &text, haystack, start, length, reverse);
+    search_needle_init(tc, &sneedle, needle, m, reverse);
+    result = search_text(&text, &sneedle, 0);
+    search_text_destroy(&text);
+    free(sneedle.codepoints);
+    if (result == -1)
+        return -1;
+    return (MVMint64)start + (reverse ? (MVMint64)(length - m) - result : result);
+}
+
 /* Returns the location of one string in another or -1  */
 MVMint64 MVM_string_index(MVMThreadContext *tc, MVMString *haystack, MVMString *needle, MVMint64 start) {
-    MVMint64 result = -1;
-    size_t index    = (size_t)start;
     MVMStringIndex hgraphs = NUM_GRAPHS(haystack), ngraphs = NUM_GRAPHS(needle);
 
     if (!IS_CONCRETE((MVMObject *)haystack)) {
@@ -286,21 +476,12 @@ MVMint64 MVM_string_index(MVMThreadContext *tc, MVMString *haystack, MVMString *
 
     if (ngraphs > hgraphs || ngraphs < 1)
         return -1;
-    /* brute force for now. horrible, yes. halp. */
-    while (index <= hgraphs - ngraphs) {
-        if (MVM_string_substrings_equal_nocheck(tc, needle, 0, ngraphs, haystack, index)) {
-            result = (MVMint64)index;
-            break;
-        }
-        index++;
-    }
-    return result;
+
+    return search(tc, haystack, start, hgraphs - start, needle, ngraphs, 0);
 }
 
 /* Returns the location of one string in another or -1  */
 MVMint64 MVM_string_index_from_end(MVMThreadContext *tc, MVMString *haystack, MVMString *needle, MVMint64 start) {
-    MVMint64 result = -1;
-    size_t index;
     MVMStringIndex hgraphs = NUM_GRAPHS(haystack), ngraphs = NUM_GRAPHS(needle);
 
     if (!IS_CONCRETE((MVMObject *)haystack)) {
@@ -327,15 +508,270 @@ MVMint64 MVM_string_index_from_end(MVMThreadContext *tc, MVMString *haystack, MV
     if (ngraphs > hgraphs || ngraphs < 1)
         return -1;
 
-    index = start;
+    /* the needle can't start any nearer the end than this. */
+    if (start > hgraphs - ngraphs)
+        start = hgraphs - ngraphs;
+
+    return search(tc, haystack, 0, start + ngraphs, needle, ngraphs, 1);
+}
 
-    /* brute force for now. horrible, yes. halp. */
-    do {
-        if (MVM_string_substrings_equal_nocheck(tc, needle, 0, ngraphs, haystack, index)) {
-            result = (MVMint64)index;
-            break;
+/* Keeps the strands of a rope tree in *data, one for each piece of a
+ * flat string found in it. */
+typedef struct {
+    MVMStrand *strands;
+    MVMStrandIndex num_strands;
+    MVMStrandIndex alloc_strands;
+} FlattenTreeState;
+
+static MVM_SUBSTRING_CONSUMER(flatten_tree_consumer) {
+    FlattenTreeState *state = (FlattenTreeState *)data;
+    MVMStrand *strand;
+    if (!length)
+        return 0;
+    /* keep room for the last row too. */
+    if (state->num_strands + 1 == state->alloc_strands) {
+        state->alloc_strands *= 2;
+        state->strands = realloc(state->strands, state->alloc_strands * sizeof(MVMStrand));
+    }
+    strand = state->strands + state->num_strands++;
+    strand->compare_offset = top_index;
+    strand->string = string;
+    strand->string_offset = start;
+    return 0;
+}
+
+/* Rebuilds a rope that has got too deep with a single strands table of the
+ * pieces of flat strings it's made of, so it has a depth of 1. Finding a
+ * codepoint is then a binary search over that table. It's done in place,
+ * so only on a rope that was just made and is not yet seen by anything. */
+static void flatten_rope_tree(MVMThreadContext *tc, MVMString *s) {
+    MVMStringIndex sgraphs = NUM_GRAPHS(s);
+    FlattenTreeState state;
+    if (!sgraphs)
+        return;
+    state.num_strands = 0;
+    state.alloc_strands = 16;
+    state.strands = malloc(state.alloc_strands * sizeof(MVMStrand));
+    MVM_string_traverse_substring(tc, s, 0, sgraphs, 0, flatten_tree_consumer, &state);
+    state.strands[state.num_strands].graphs = sgraphs;
+    state.strands[state.num_strands].strand_depth = 1;
+    free(s->body.strands);
+    s->body.strands = state.strands;
+    s->body.num_strands = state.num_strands;
+}
+
+/* stops the traversal at the first codepoint that doesn't fit in 8 bits. */
+static MVM_SUBSTRING_CONSUMER(wide_consumer) {
+    MVMStringIndex i;
+    if (IS_WIDE(string)) {
+        MVMCodepoint32 *cps = string->body.int32s + start;
+        for (i = 0; i < length; i++)
+            if (cps[i] < 0 || cps[i] > 255)
+                return 1;
+    }
+    return 0;
+}
+
+/* copies codepoints into the flat string in *data, from top_index on. */
+static MVM_SUBSTRING_CONSUMER(flat_copy_consumer) {
+    MVMString *result = (MVMString *)data;
+    MVMStringIndex i;
+    if (IS_WIDE(result)) {
+        MVMCodepoint32 *to = result->body.int32s + top_index;
+        if (IS_WIDE(string))
+            memcpy(to, string->body.int32s + start, length * sizeof(MVMCodepoint32));
+        else
+            for (i = 0; i < length; i++)
+                to[i] = string->body.uint8s[start + i];
+    }
+    else {
+        MVMCodepoint8 *to = result->body.uint8s + top_index;
+        if (IS_WIDE(string))
+            for (i = 0; i < length; i++)
+                to[i] = (MVMCodepoint8)string->body.int32s[start + i];
+        else
+            memcpy(to, string->body.uint8s + start, length);
+    }
+    return 0;
+}
+
+/* One side of a string being made by concatenation: the strands of the
+ * rope string from first up to end or, if end is 0, length graphemes of
+ * string from offset. */
+typedef struct {
+    MVMString *string;
+    MVMStrandIndex first;
+    MVMStrandIndex end;
+    MVMStringIndex offset;
+    MVMStringIndex length;
+} RopePart;
+
+static void part_of_string(RopePart *part, MVMString *s, MVMStringIndex offset, MVMStringIndex length) {
+    part->string = s;
+    part->first = part->end = 0;
+    part->offset = offset;
+    part->length = length;
+}
+
+static void part_of_strands(RopePart *part, MVMString *s, MVMStrandIndex first, MVMStrandIndex end) {
+    part->string = s;
+    part->first = first;
+    part->end = end;
+    part->offset = part->length = 0;
+}
+
+/* Makes a flat string of two parts of strings; used when that's short, as
+ * copying a few codepoints costs less than a rope does. */
+static MVMString * flat_concatenate(MVMThreadContext *tc, RopePart *left, RopePart *right) {
+    MVMString *result;
+    MVMuint8 wide;
+
+    MVMROOT(tc, left->string, {
+    MVMROOT(tc, right->string, {
+        result = (MVMString *)REPR(left->string)->allocate(tc, STABLE(left->string));
+    });
+    });
+
+    wide = MVM_string_traverse_substring(tc, left->string, left->offset, left->length, 0, wide_consumer, NULL)
+        || MVM_string_traverse_substring(tc, right->string, right->offset, right->length, 0, wide_consumer, NULL);
+    result->body.graphs = left->length + right->length;
+    if (wide) {
+        result->body.flags = MVM_STRING_TYPE_INT32;
+        result->body.int32s = malloc(result->body.graphs * sizeof(MVMCodepoint32));
+    }
+    else {
+        result->body.flags = MVM_STRING_TYPE_UINT8;
+        result->body.uint8s = malloc(result->body.graphs);
+    }
+    MVM_string_traverse_substring(tc, left->string, left->offset, left->length,
+        0, flat_copy_consumer, result);
+    MVM_string_traverse_substring(tc, right->string, right->offset, right->length,
+        left->length, flat_copy_consumer, result);
+    return result;
+}
+
+/* Adds the strands for a part to those of a rope being made, giving the
+ * position after them; *depth is raised to the depth they give the rope. */
+static MVMStringIndex add_part_strands(MVMStrand *strands, RopePart *part,
+        MVMStringIndex position, MVMStringIndex *depth) {
+    MVMString *s = part->string;
+    MVMStringIndex part_depth;
+    if (part->end) {
+        MVMStrand *from = s->body.strands + part->first;
+        MVMStringIndex base = from->compare_offset;
+        MVMStrandIndex i;
+        for (i = 0; i < part->end - part->first; i++) {
+            strands[i].compare_offset = position + from[i].compare_offset - base;
+            strands[i].string = from[i].string;
+            strands[i].string_offset = from[i].string_offset;
         }
-    } while (index-- > 0);
+        position += s->body.strands[part->end].compare_offset - base;
+        part_depth = STRAND_DEPTH(s);
+    }
+    else {
+        strands->compare_offset = position;
+        strands->string = s;
+        strands->string_offset = part->offset;
+        position += part->length;
+        part_depth = STRAND_DEPTH(s) + 1;
+    }
+    if (part_depth > *depth)
+        *depth = part_depth;
+    return position;
+}
+
+/* Makes a rope of two parts of strings. */
+static MVMString * make_rope(MVMThreadContext *tc, RopePart *left, RopePart *right) {
+    MVMString *result;
+    MVMStrand *strands;
+    MVMStrandIndex num_left = left->end ? left->end - left->first : 1;
+    MVMStrandIndex count = num_left + (right->end ? right->end - right->first : 1);
+    MVMStringIndex position, depth = 0;
+
+    MVMROOT(tc, left->string, {
+    MVMROOT(tc, right->string, {
+        result = (MVMString *)REPR(left->string)->allocate(tc, STABLE(left->string));
+    });
+    });
+
+    strands = calloc(sizeof(MVMStrand), count + 1);
+    position = add_part_strands(strands, left, 0, &depth);
+    position = add_part_strands(strands + num_left, right, position, &depth);
+    strands[count].graphs = position;
+    strands[count].strand_depth = depth;
+    result->body.strands = strands;
+    result->body.num_strands = count;
+    result->body.flags = MVM_STRING_TYPE_ROPE;
+    return result;
+}
+
+/* Tries to make length graphemes of a from offset, with b after them (or
+ * before them, if prepend is set), into a string no deeper than limit, or
+ * else gives NULL. Ropes made by concatenation are kept like a B-tree: when
+ * a is a whole rope of few enough strands, b goes into its last strand (or
+ * first, when prepending) if that takes it without getting any deeper, or
+ * else is added as a strand if there's room. Only the path down the edge
+ * of the tree is copied, and the tree only gets deeper when all that fails,
+ * so building a string by appending (or prepending) keeps it log(n) deep. */
+static MVMString * concatenate_fit(MVMThreadContext *tc, MVMString *a, MVMStringIndex offset,
+        MVMStringIndex length, MVMString *b, MVMStringIndex limit, MVMuint8 prepend) {
+    MVMString *result = NULL;
+    MVMStringIndex bgraphs = NUM_GRAPHS(b), depth = STRAND_DEPTH(a), bdepth = STRAND_DEPTH(b);
+    RopePart apart, bpart;
+
+    part_of_string(&bpart, b, 0, bgraphs);
+    if (length + bgraphs <= MVM_STRING_FLATTEN_GRAPHS) {
+        part_of_string(&apart, a, offset, length);
+        return prepend
+            ? flat_concatenate(tc, &bpart, &apart)
+            : flat_concatenate(tc, &apart, &bpart);
+    }
+
+    if (IS_ROPE(a) && !offset && length == NUM_ROPE_GRAPHS(a) && depth <= limit
+            && a->body.num_strands <= MVM_STRING_MAX_STRANDS) {
+        MVMStrandIndex num_strands = a->body.num_strands;
+        MVMStrand *edge = a->body.strands + (prepend ? 0 : num_strands - 1);
+        MVMROOT(tc, a, {
+        MVMROOT(tc, b, {
+            MVMuint8 fits = 1;
+            result = concatenate_fit(tc, edge->string, edge->string_offset,
+                (edge + 1)->compare_offset - edge->compare_offset, b, depth - 1, prepend);
+            if (result) {
+                /* a rope of one strand is as good as what's in it. */
+                fits = num_strands > 1;
+                part_of_string(&bpart, result, 0, NUM_GRAPHS(result));
+                if (prepend)
+                    part_of_strands(&apart, a, 1, num_strands);
+                else
+                    part_of_strands(&apart, a, 0, num_strands - 1);
+            }
+            else if (IS_ROPE(b) && bdepth <= depth
+                    && num_strands + b->body.num_strands <= MVM_STRING_MAX_STRANDS) {
+                part_of_strands(&bpart, b, 0, b->body.num_strands);
+                part_of_strands(&apart, a, 0, num_strands);
+            }
+            else if (bdepth < depth && num_strands < MVM_STRING_MAX_STRANDS) {
+                part_of_strands(&apart, a, 0, num_strands);
+            }
+            else {
+                fits = 0;
+            }
+            if (fits)
+                result = prepend
+                    ? make_rope(tc, &bpart, &apart)
+                    : make_rope(tc, &apart, &bpart);
+        });
+        });
+        if (result)
+            return result;
+    }
+
+    if ((depth > bdepth ? depth : bdepth) < limit) {
+        part_of_string(&apart, a, offset, length);
+        result = prepend
+            ? make_rope(tc, &bpart, &apart)
+            : make_rope(tc, &apart, &bpart);
+    }
     return result;
 }
 
@@ -386,60 +822,48 @@ MVMString * MVM_string_substring(MVMThreadContext *tc, MVMString *a, MVMint64 st
     result->body.num_strands = 1;
     strands[1].graphs = length;
     _STRAND_DEPTH(result) = STRAND_DEPTH(strands->string) + 1;
+    if (_STRAND_DEPTH(result) > MVM_STRING_MAX_DEPTH)
+        flatten_rope_tree(tc, result);
 
     return result;
 }
 
 /* Append one string to another. */
-/* XXX inline parent's strands if it's a rope too? */
 MVMString * MVM_string_concatenate(MVMThreadContext *tc, MVMString *a, MVMString *b) {
     MVMString *result;
-    MVMStrandIndex strand_count = 0;
-    MVMStrand *strands;
-    MVMStringIndex index = 0;
-    MVMStrandIndex max_strand_depth = 0;
-    MVMStringIndex agraphs = NUM_GRAPHS(a), bgraphs = NUM_GRAPHS(b), rgraphs;
+    MVMStringIndex agraphs = NUM_GRAPHS(a), bgraphs = NUM_GRAPHS(b);
 
     if (!IS_CONCRETE((MVMObject *)a) || !IS_CONCRETE((MVMObject *)b)) {
         MVM_exception_throw_adhoc(tc, "Concatenate needs concrete strings");
     }
 
-    MVM_gc_root_temp_push(tc, (MVMCollectable **)&a);
-    result = (MVMString *)REPR(a)->allocate(tc, STABLE(a));
-    MVM_gc_root_temp_pop(tc);
+    /* if either is empty, it's just the other. */
+    if (!bgraphs)
+        return MVM_string_substring(tc, a, 0, -1);
+    if (!agraphs)
+        return MVM_string_substring(tc, b, 0, -1);
 
     /* there could be unattached combining chars at the beginning of b,
        so, XXX TODO handle this */
-    result->body.flags = MVM_STRING_TYPE_ROPE;
-    rgraphs = agraphs + bgraphs;
-
-    if (agraphs)
-        strand_count = 1;
-    if (bgraphs)
-        ++strand_count;
-    strands = result->body.strands = calloc(sizeof(MVMStrand), strand_count + 1);
-    strand_count = 0;
-    if (agraphs) {
-        strands->string = a;
-        strands->string_offset = 0;
-        strands->compare_offset = index;
-        index = agraphs;
-        strand_count = 1;
-        max_strand_depth = STRAND_DEPTH(a);
-    }
-    if (bgraphs) {
-        strands[strand_count].string = b;
-        strands[strand_count].string_offset = 0;
-        strands[strand_count].compare_offset = index;
-        index += bgraphs;
-        ++strand_count;
-        if (STRAND_DEPTH(b) > max_strand_depth)
-            max_strand_depth = STRAND_DEPTH(b);
-    }
-    strands[strand_count].graphs = index;
-    result->body.num_strands = strand_count;
-    result->body.flags = MVM_STRING_TYPE_ROPE;
-    _STRAND_DEPTH(result) = max_strand_depth + 1;
+    MVMROOT(tc, a, {
+    MVMROOT(tc, b, {
+        result = concatenate_fit(tc, a, 0, agraphs, b, STRAND_DEPTH(a), 0);
+        if (!result)
+            result = concatenate_fit(tc, b, 0, bgraphs, a, STRAND_DEPTH(b), 1);
+        if (!result) {
+            RopePart left;
+            RopePart right;
+            part_of_string(&left, a, 0, agraphs);
+            if (IS_ROPE(b) && b->body.num_strands < MVM_STRING_MAX_STRANDS)
+                part_of_strands(&right, b, 0, b->body.num_strands);
+            else
+                part_of_string(&right, b, 0, bgraphs);
+            result = make_rope(tc, &left, &right);
+        }
+    });
+    });
+    if (STRAND_DEPTH(result) > MVM_STRING_MAX_DEPTH)
+        flatten_rope_tree(tc, result);
 
     return result;
 }
@@ -717,28 +1141,50 @@ unsigned char * MVM_encode_string_to_C_buffer(MVMThreadContext *tc, MVMString *s
 MVMObject * MVM_string_split(MVMThreadContext *tc, MVMString *separator, MVMString *input) {
     MVMObject *result;
     MVMStringIndex start, end, sep_length;
+    MVMStringIndex *found = NULL, num_found = 0, next_found = 0;
     MVMHLLConfig *hll = MVM_hll_current(tc);
 
     if (!IS_CONCRETE((MVMObject *)separator)) {
         MVM_exception_throw_adhoc(tc, "split needs a concrete string separator");
     }
 
+    end = NUM_GRAPHS(input);
+    sep_length = NUM_GRAPHS(separator);
+
+    /* Find where all the separators are up front, in one pass over the
+     * input, since the search can't be kept across the allocations. */
+    if (sep_length && end >= sep_length) {
+        SearchText text;
+        SearchNeedle needle;
+        MVMStringIndex alloc_found = 16;
+        MVMint64 index = 0;
+        found = malloc(alloc_found * sizeof(MVMStringIndex));
+        search_text_init(tc, &text, input, 0, end, 0);
+        search_needle_init(tc, &needle, separator, sep_length, 0);
+        while ((index = search_text(&text, &needle, index)) != -1) {
+            if (num_found == alloc_found) {
+                alloc_found *= 2;
+                found = realloc(found, alloc_found * sizeof(MVMStringIndex));
+            }
+            found[num_found++] = index;
+            index += sep_length;
+        }
+        search_text_destroy(&text);
+        free(needle.codepoints);
+    }
+
     MVMROOT(tc, input, {
     MVMROOT(tc, separator, {
         result = MVM_repr_alloc_init(tc, hll->slurpy_array_type);
         MVMROOT(tc, result, {
             start = 0;
-            end = NUM_GRAPHS(input);
-            sep_length = NUM_GRAPHS(separator);
 
             while (start < end) {
                 MVMString *portion;
                 MVMStringIndex index;
                 MVMStringIndex length;
 
-                /* XXX make this use the dual-traverse iterator, but such that it
-                    can reset the index of what it's comparing... <!> */
-                index = MVM_string_index(tc, input, separator, start);
+                index = next_found < num_found ? found[next_found++] : -1;
                 length = sep_length ? (index == -1 ? end : index) - start : 1;
                 if (length > 0 || (sep_length && length == 0)) {
                     portion = MVM_string_substring(tc, input, start, length);
@@ -763,6 +1209,8 @@ MVMObject * MVM_string_split(MVMThreadContext *tc, MVMString *separator, MVMStri
     });
     });
 
+    if (found)
+        free(found);
     return result;
 }
 
@@ -854,6 +1302,8 @@ MVMString * MVM_string_join(MVMThreadContext *tc, MVMString *separator, MVMObjec
                 strands[portion_index].strand_depth = max_strand_depth + 1;
                 result->body.flags = MVM_STRING_TYPE_ROPE;
                 result->body.num_strands = portion_index;
+                if (max_strand_depth + 1 > MVM_STRING_MAX_DEPTH)
+                    flatten_rope_tree(tc, result);
             }
             else {
                 /* leave type default of int32 and graphs 0 */
@@ -930,11 +1380,56 @@ MVMint64 MVM_string_offset_has_unicode_property_value(MVMThreadContext *tc, MVMS
         MVM_string_get_codepoint_at_nocheck(tc, s, offset), property_code, property_value_code);
 }
 
-/* internal function so hashes can easily compute hashes of hash keys */
+/* Hashes the codepoints of a piece of a flat string into *data, one at a
+ * time with FNV-1a, so it comes out the same for any form of the string. */
+static MVM_SUBSTRING_CONSUMER(hash_consumer) {
+    MVMuint32 hash = *(MVMuint32 *)data;
+    MVMStringIndex i;
+    if (IS_WIDE(string)) {
+        MVMCodepoint32 *cps = string->body.int32s + start;
+        for (i = 0; i < length; i++)
+            hash = (hash ^ (MVMuint32)cps[i]) * 16777619U;
+    }
+    else {
+        MVMCodepoint8 *cps = string->body.uint8s + start;
+        for (i = 0; i < length; i++)
+            hash = (hash ^ cps[i]) * 16777619U;
+    }
+    *(MVMuint32 *)data = hash;
+    return 0;
+}
+
+/* Gives the hash code of a string, computing it the first time and keeping
+ * it in the string. Two threads may both compute it, but they'll store the
+ * same value. The result is mixed so that the low bits, which hash tables
+ * go by, depend on all of it; it is never 0, which means not computed. */
+MVMuint32 MVM_string_hash_code(MVMThreadContext *tc, MVMString *s) {
+    MVMuint32 hash = s->body.hash_code;
+    MVMStringIndex sgraphs;
+    if (hash)
+        return hash;
+    hash = 2166136261U;
+    sgraphs = NUM_GRAPHS(s);
+    if (sgraphs)
+        MVM_string_traverse_substring(tc, s, 0, sgraphs, 0, hash_consumer, &hash);
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6BU;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35U;
+    hash ^= hash >> 16;
+    if (!hash)
+        hash = 1;
+    return s->body.hash_code = hash;
+}
+
+/* Turns a string into a flat one of 32-bit codepoints, in place. The uthash
+ * tables the VM keeps for its own lookups (see MVM_HASH_EXTRACT_KEY) hash
+ * and compare keys as raw buffers, so their keys must all be in this form;
+ * MVMHash hashes keys with MVM_string_hash_code instead, and doesn't need
+ * it. This is not thread-safe: it swaps in a new buffer and frees the old
+ * one, so strings that other threads may be reading, such as string heap
+ * constants, must already be flat and 32-bit. */
 void MVM_string_flatten(MVMThreadContext *tc, MVMString *s) {
-    /* XXX This is temporary until we can get the hashing mechanism
-        to compute the hash (and test for equivalence!) using the
-        codepoint iterator interface.  It's not thread-safe. */
     MVMStringIndex position = 0, sgraphs = NUM_GRAPHS(s);
     void *storage = s->body.storage;
     MVMCodepoint32 *buffer;
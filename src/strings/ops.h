@@ -65,6 +65,13 @@ typedef MVM_SUBSTRING_CONSUMER((*MVMSubstringConsumer));
 #define STRAND_DEPTH(str) ((IS_ROPE((str)) && NUM_ROPE_GRAPHS(str)) ? _STRAND_DEPTH((str)) : 0)
 /* whether the rope is composed of only one segment of another string */
 #define IS_ONE_STRING_ROPE(str) (IS_ROPE((str)) && (str)->body.num_strands == 1)
+/* concatenations of at most this many graphemes make a flat string. */
+#define MVM_STRING_FLATTEN_GRAPHS 32
+/* the most strands a rope made by concatenation has, above which it gets
+    another level. */
+#define MVM_STRING_MAX_STRANDS 16
+/* ropes made deeper than this are rebuilt with a single strands table. */
+#define MVM_STRING_MAX_DEPTH 16
 
 struct MVMConcatState {
     MVMuint32 some_state;
@@ -85,6 +92,7 @@ struct MVMConcatState {
 #define MVM_CCLASS_NEWLINE      4096
 #define MVM_CCLASS_WORD         8192
 
+MVMuint8 MVM_string_traverse_substring(MVMThreadContext *tc, MVMString *a, MVMStringIndex start, MVMStringIndex length, MVMStringIndex top_index, MVMSubstringConsumer consumer, void *data);
 MVMCodepoint32 MVM_string_get_codepoint_at_nocheck(MVMThreadContext *tc, MVMString *a, MVMint64 index);
 MVMint64 MVM_string_equal(MVMThreadContext *tc, MVMString *a, MVMString *b);
 MVMint64 MVM_string_index(MVMThreadContext *tc, MVMString *haystack, MVMString *needle, MVMint64 start);
@@ -109,6 +117,7 @@ MVMString * MVM_string_join(MVMThreadContext *tc, MVMString *separator, MVMObjec
 MVMint64 MVM_string_char_at_in_string(MVMThreadContext *tc, MVMString *a, MVMint64 offset, MVMString *b);
 MVMint64 MVM_string_offset_has_unicode_property_value(MVMThreadContext *tc, MVMString *s, MVMint64 offset, MVMint64 property_code, MVMint64 property_value_code);
 void MVM_string_flatten(MVMThreadContext *tc, MVMString *s);
+MVMuint32 MVM_string_hash_code(MVMThreadContext *tc, MVMString *s);
 MVMString * MVM_string_escape(MVMThreadContext *tc, MVMString *s);
 MVMString * MVM_string_flip(MVMThreadContext *tc, MVMString *s);
 MVMint64 MVM_string_compare(MVMThreadContext *tc, MVMString *a, MVMString *b);
@@ -1,5 +1,10 @@
 #include "moarvm.h"
 
+#if defined(__SSE2__) || defined(_M_X64)
+#define MVM_UTF8_SSE2
+#include <emmintrin.h>
+#endif
+
 /* The below section has an MIT-style license, included here.
 
 // Copyright (c) 2008-2010 Bjoern Hoehrmann <bjoern@hoehrmann.de>
@@ -186,96 +191,237 @@ static void *utf8_encode(void *bytes, MVMCodepoint32 cp)
 
  /* end not_gerd section */
 
-#define UTF8_MAXINC 32 * 1024 * 1024
+/* Gives the number of bytes at the start of a buffer that are ASCII. Those
+ * are checked 16 at a time with SSE2 where we have it (it's always there on
+ * x86-64), and a word at a time otherwise. */
+static size_t ascii_run(const MVMuint8 *bytes, size_t length) {
+    size_t i = 0;
+#ifdef MVM_UTF8_SSE2
+    while (i + 16 <= length
+            && !_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(bytes + i))))
+        i += 16;
+#else
+    MVMuint64 word;
+    while (i + 8 <= length) {
+        memcpy(&word, bytes + i, 8);
+        if (word & 0x8080808080808080ULL)
+            break;
+        i += 8;
+    }
+#endif
+    while (i < length && bytes[i] < 0x80)
+        i++;
+    return i;
+}
+
+/* Throws an exception for malformed UTF-8, parsing it again to find the line
+ * and column it's at. */
+static void throw_malformed(MVMThreadContext *tc, const MVMuint8 *utf8, size_t bytes) {
+    MVMCodepoint32 codepoint;
+    MVMint32 line_ending = 0;
+    MVMint32 state = 0;
+    MVMint32 line = 1;
+    MVMint32 col = 1;
+    for (; bytes; ++utf8, --bytes) {
+        switch(decode_utf8_byte(&state, &codepoint, *utf8)) {
+        case UTF8_ACCEPT:
+            /* this could be reorganized into several nested ugly if/else :/ */
+            if (!line_ending && (codepoint == 10 || codepoint == 13)) {
+                /* Detect the style of line endings.
+                 * Select whichever comes first.
+                 * First or only part of first line ending. */
+                line_ending = codepoint;
+                col = 1; line++;
+            }
+            else if (line_ending && codepoint == line_ending) {
+                /* first or only part of next line ending */
+                col = 1; line++;
+            }
+            else if (codepoint == 10 || codepoint == 13) {
+                /* second part of line ending; ignore */
+            }
+            else /* non-line ending codepoint */
+                col++;
+            break;
+        case UTF8_REJECT:
+            MVM_exception_throw_adhoc(tc, "Malformed UTF-8 at line %u col %u", line, col);
+        }
+    }
+    MVM_exception_throw_adhoc(tc, "Concurrent modification of UTF-8 input buffer!");
+}
+
 /* Decodes the specified number of bytes of utf8 into an NFG string, creating
  * a result of the specified type. The type must have the MVMString REPR.
- * Only bring in the raw codepoints for now. */
-MVMString * MVM_string_utf8_decode(MVMThreadContext *tc, MVMObject *result_type, const char *utf8, size_t bytes) {
+ * Only bring in the raw codepoints for now. A first pass validates the input,
+ * counts the codepoints and finds if they all fit in 8 bits; the second then
+ * decodes them into a buffer of just the right size, of 8-bit codepoints if
+ * it can and wide is not set. Both skip over runs of ASCII quickly. */
+static MVMString * decode(MVMThreadContext *tc, MVMObject *result_type, const char *utf8_chars, size_t bytes, MVMuint8 wide) {
     MVMString *result = (MVMString *)REPR(result_type)->allocate(tc, STABLE(result_type));
-    MVMint32 count = 0;
+    const MVMuint8 *utf8 = (const MVMuint8 *)utf8_chars;
+    MVMStringIndex count = 0, pos = 0;
     MVMCodepoint32 codepoint;
-    MVMint32 line_ending = 0;
     MVMint32 state = 0;
-    MVMint32 bufsize = 16;
-    MVMint32 *buffer = malloc(sizeof(MVMint32) * bufsize);
-    size_t orig_bytes;
-    const char *orig_utf8;
-    MVMint32 line;
-    MVMint32 col;
-
-    if (bytes >= 3 && utf8[0] == 0xEF && utf8[1] == 0xBB && utf8[0xBF]) {
+    size_t i = 0, run;
+
+    if (bytes >= 3 && utf8[0] == 0xEF && utf8[1] == 0xBB && utf8[2] == 0xBF) {
         /* disregard UTF-8 BOM if it's present */
         utf8 += 3; bytes -= 3;
     }
-    orig_bytes = bytes;
-    orig_utf8 = utf8;
 
-    for (; bytes; ++utf8, --bytes) {
-        switch(decode_utf8_byte(&state, &codepoint, *utf8)) {
+    /* Validate and count. */
+    while (i < bytes) {
+        if (state == UTF8_ACCEPT && utf8[i] < 0x80) {
+            run = ascii_run(utf8 + i, bytes - i);
+            count += run;
+            i += run;
+            continue;
+        }
+        switch(decode_utf8_byte(&state, &codepoint, utf8[i++])) {
         case UTF8_ACCEPT: /* got a codepoint */
-            if (count == bufsize) { /* if the buffer's full make a bigger one */
-                buffer = realloc(buffer, sizeof(MVMint32) * (
-                    bufsize >= UTF8_MAXINC ? (bufsize += UTF8_MAXINC) : (bufsize *= 2)
-                ));
-            }
-            buffer[count++] = codepoint;
+            count++;
+            if (codepoint > 0xFF)
+                wide = 1;
             break;
         case UTF8_REJECT:
-            /* found a malformed sequence; parse it again this time tracking
-             * line and col numbers. */
-            bytes = orig_bytes; utf8 = orig_utf8; state = 0; line = 1; col = 1;
-            for (; bytes; ++utf8, --bytes) {
-                switch(decode_utf8_byte(&state, &codepoint, *utf8)) {
-                case UTF8_ACCEPT:
-                    /* this could be reorganized into several nested ugly if/else :/ */
-                    if (!line_ending && (codepoint == 10 || codepoint == 13)) {
-                        /* Detect the style of line endings.
-                         * Select whichever comes first.
-                         * First or only part of first line ending. */
-                        line_ending = codepoint;
-                        col = 1; line++;
-                    }
-                    else if (line_ending && codepoint == line_ending) {
-                        /* first or only part of next line ending */
-                        col = 1; line++;
-                    }
-                    else if (codepoint == 10 || codepoint == 13) {
-                        /* second part of line ending; ignore */
-                    }
-                    else /* non-line ending codepoint */
-                        col++;
-                    break;
-                case UTF8_REJECT:
-                    MVM_exception_throw_adhoc(tc, "Malformed UTF-8 at line %u col %u", line, col);
-                }
-            }
-            MVM_exception_throw_adhoc(tc, "Concurrent modification of UTF-8 input buffer!");
-            break;
+            throw_malformed(tc, utf8, bytes);
         }
     }
     if (state != UTF8_ACCEPT)
         MVM_exception_throw_adhoc(tc, "Malformed termination of UTF-8 string");
 
-    /* just keep the same buffer as the MVMString's buffer.  Later
-     * we can add heuristics to resize it if we have enough free
-     * memory */
-    result->body.int32s = buffer;
+    /* Decode. Should the input have changed since we counted, the count
+     * no longer holds, so check we stay within it. */
+    if (wide)
+        result->body.int32s = malloc(sizeof(MVMCodepoint32) * count);
+    else
+        result->body.uint8s = malloc(sizeof(MVMCodepoint8) * count);
+    for (i = 0; i < bytes; ) {
+        if (state == UTF8_ACCEPT && utf8[i] < 0x80) {
+            run = ascii_run(utf8 + i, bytes - i);
+            if (run > count - pos)
+                throw_malformed(tc, utf8, 0);
+            if (wide) {
+                MVMCodepoint32 *out = result->body.int32s + pos;
+                size_t j;
+                for (j = 0; j < run; j++)
+                    out[j] = utf8[i + j];
+            }
+            else {
+                memcpy(result->body.uint8s + pos, utf8 + i, run);
+            }
+            pos += run;
+            i += run;
+            continue;
+        }
+        switch(decode_utf8_byte(&state, &codepoint, utf8[i++])) {
+        case UTF8_ACCEPT:
+            if (pos == count || (!wide && codepoint > 0xFF))
+                throw_malformed(tc, utf8, 0);
+            if (wide)
+                result->body.int32s[pos++] = codepoint;
+            else
+                result->body.uint8s[pos++] = (MVMCodepoint8)codepoint;
+            break;
+        case UTF8_REJECT:
+            throw_malformed(tc, utf8, bytes);
+        }
+    }
+    if (pos != count || state != UTF8_ACCEPT)
+        throw_malformed(tc, utf8, 0);
 
-    /* XXX set codes */
-    result->body.flags = MVM_STRING_TYPE_INT32;
+    result->body.flags = wide ? MVM_STRING_TYPE_INT32 : MVM_STRING_TYPE_UINT8;
+    result->body.codes = count;
     result->body.graphs = count; /* XXX Ignore combining chars for now. */
 
     return result;
 }
 
-/* Encodes the specified string to UTF-8. */
+/* Decodes utf8 into a string of 8-bit codepoints where they all fit, or of
+ * 32-bit ones otherwise. */
+MVMString * MVM_string_utf8_decode(MVMThreadContext *tc, MVMObject *result_type, const char *utf8_chars, size_t bytes) {
+    return decode(tc, result_type, utf8_chars, bytes, 0);
+}
+
+/* Decodes utf8 into a string of 32-bit codepoints. This is for strings that
+ * are shared between threads and looked up in the VM's own hashes, such as
+ * those of a compilation unit's string heap: MVM_string_flatten would widen
+ * any other kind in place, under the feet of other threads. */
+MVMString * MVM_string_utf8_decode_wide(MVMThreadContext *tc, MVMObject *result_type, const char *utf8_chars, size_t bytes) {
+    return decode(tc, result_type, utf8_chars, bytes, 1);
+}
+
+/* Encodes a piece of a flat string to UTF-8, at the position in *data, and
+ * advances it. Runs of ASCII in 8-bit strings are copied as they are, and in
+ * 32-bit strings they are narrowed 16 at a time with SSE2 where we have it. */
+static MVM_SUBSTRING_CONSUMER(encode_consumer) {
+    MVMuint8 *out = *(MVMuint8 **)data;
+    MVMStringIndex i = 0;
+    size_t run;
+
+    if (IS_ASCII(string)) {
+        MVMCodepoint8 *cps = string->body.uint8s + start;
+        while (i < length) {
+            run = ascii_run(cps + i, length - i);
+            memcpy(out, cps + i, run);
+            out += run;
+            i += run;
+            while (i < length && cps[i] >= 0x80) {
+                out[0] = (MVMuint8)(0xC0 | (cps[i] >> 6));
+                out[1] = (MVMuint8)(0x80 | (cps[i] & 0x3F));
+                out += 2;
+                i++;
+            }
+        }
+    }
+    else {
+        MVMCodepoint32 *cps = string->body.int32s + start;
+        MVMuint8 *next;
+        while (i < length) {
+#ifdef MVM_UTF8_SSE2
+            while (i + 16 <= length) {
+                __m128i a = _mm_loadu_si128((const __m128i *)(cps + i));
+                __m128i b = _mm_loadu_si128((const __m128i *)(cps + i + 4));
+                __m128i c = _mm_loadu_si128((const __m128i *)(cps + i + 8));
+                __m128i d = _mm_loadu_si128((const __m128i *)(cps + i + 12));
+                __m128i high = _mm_and_si128(
+                    _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)),
+                    _mm_set1_epi32(~0x7F));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(high, _mm_setzero_si128())) != 0xFFFF)
+                    break;
+                _mm_storeu_si128((__m128i *)out,
+                    _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+                out += 16;
+                i += 16;
+            }
+#endif
+            if (i == length)
+                break;
+            if (!(cps[i] & ~0x7F)) {
+                *out++ = (MVMuint8)cps[i++];
+                continue;
+            }
+            if (!(next = utf8_encode(out, cps[i])))
+                MVM_exception_throw_adhoc(tc,
+                    "Error encoding UTF-8 string near grapheme position %d with codepoint %d",
+                        (int)(top_index + i), cps[i]);
+            out = next;
+            i++;
+        }
+    }
+
+    *(MVMuint8 **)data = out;
+    return 0;
+}
+
+/* Encodes the specified string to UTF-8. Ropes are encoded strand by
+ * strand. */
 MVMuint8 * MVM_string_utf8_encode_substr(MVMThreadContext *tc,
         MVMString *str, MVMuint64 *output_size, MVMint64 start, MVMint64 length) {
     /* XXX This is terribly wrong when we get to doing NFG properly too. One graph may
      * expand to loads of codepoints and overflow the buffer. */
     MVMuint8 *result;
     MVMuint8 *arr;
-    size_t i = start;
     MVMStringIndex strgraphs = NUM_GRAPHS(str);
 
     if (length == -1)
@@ -287,19 +433,15 @@ MVMuint8 * MVM_string_utf8_encode_substr(MVMThreadContext *tc,
     if (length < 0 || start + length > strgraphs)
         MVM_exception_throw_adhoc(tc, "length out of range");
 
-    /* give it two spaces for padding in case `say` wants to append a \r\n or \n */
-    result = malloc(sizeof(MVMint32) * length + 2);
+    /* give it two spaces for padding in case `say` wants to append a \r\n or \n;
+     * an 8-bit codepoint takes at most 2 bytes */
+    result = malloc((IS_ASCII(str) ? 2 : sizeof(MVMint32)) * length + 2);
     arr = result;
-
-    memset(result, 0, sizeof(MVMint32) * length);
-    while (i < length && (arr = utf8_encode(arr, MVM_string_get_codepoint_at_nocheck(tc, str, i++))));
-    if (!arr)
-        MVM_exception_throw_adhoc(tc,
-            "Error encoding UTF-8 string near grapheme position %d with codepoint %d",
-                i - 1, MVM_string_get_codepoint_at_nocheck(tc, str, i-1));
+    if (length)
+        MVM_string_traverse_substring(tc, str, start, length, start, encode_consumer, &arr);
 
     if (output_size)
-        *output_size = (MVMuint64)(arr ? arr - result : 0);
+        *output_size = (MVMuint64)(arr - result);
 
     return result;
 }
@@ -12,6 +12,8 @@ typedef struct MVMBootTypes MVMBootTypes;
 typedef struct MVMCallCapture MVMCallCapture;
 typedef struct MVMCallCaptureBody MVMCallCaptureBody;
 typedef struct MVMCallsite MVMCallsite;
+typedef struct MVMCallsiteInterns MVMCallsiteInterns;
+typedef struct MVMCallStackRegion MVMCallStackRegion;
 typedef struct MVMCFunction MVMCFunction;
 typedef struct MVMCFunctionBody MVMCFunctionBody;
 typedef struct MVMCode MVMCode;
@@ -29,7 +31,12 @@ typedef struct MVMExceptionBody MVMExceptionBody;
 typedef struct MVMFrame MVMFrame;
 typedef struct MVMFrameHandler MVMFrameHandler;
 typedef struct MVMGen2Allocator MVMGen2Allocator;
+typedef struct MVMGen2LargeHeader MVMGen2LargeHeader;
+typedef struct MVMGen2LargeObjects MVMGen2LargeObjects;
+typedef struct MVMGen2LargeRegion MVMGen2LargeRegion;
 typedef struct MVMGen2SizeClass MVMGen2SizeClass;
+typedef struct MVMGCStats MVMGCStats;
+typedef struct MVMGCCardTable MVMGCCardTable;
 typedef struct MVMGCPassedWork MVMGCPassedWork;
 typedef struct MVMGCWorklist MVMGCWorklist;
 typedef struct MVMHash MVMHash;
@@ -37,6 +44,7 @@ typedef struct MVMHashAttrStore MVMHashAttrStore;
 typedef struct MVMHashAttrStoreBody MVMHashAttrStoreBody;
 typedef struct MVMHashBody MVMHashBody;
 typedef struct MVMHashEntry MVMHashEntry;
+typedef struct MVMHashPair MVMHashPair;
 typedef struct MVMHLLConfig MVMHLLConfig;
 typedef struct MVMInstance MVMInstance;
 typedef struct MVMInvocationSpec MVMInvocationSpec;
@@ -46,15 +54,18 @@ typedef struct MVMKnowHOWAttributeREPR MVMKnowHOWAttributeREPR;
 typedef struct MVMKnowHOWAttributeREPRBody MVMKnowHOWAttributeREPRBody;
 typedef struct MVMKnowHOWREPR MVMKnowHOWREPR;
 typedef struct MVMKnowHOWREPRBody MVMKnowHOWREPRBody;
+typedef struct MVMLexicalCache MVMLexicalCache;
 typedef struct MVMLexicalHashEntry MVMLexicalHashEntry;
 typedef struct MVMLexotic MVMLexotic;
 typedef struct MVMLexoticBody MVMLexoticBody;
+typedef struct MVMNamedHints MVMNamedHints;
 typedef struct MVMNFA MVMNFA;
 typedef struct MVMNFABody MVMNFABody;
 typedef struct MVMNFAStateInfo MVMNFAStateInfo;
 typedef struct MVMObject MVMObject;
 typedef struct MVMObjectStooge MVMObjectStooge;
 typedef struct MVMOpInfo MVMOpInfo;
+typedef struct MVMOpProfile MVMOpProfile;
 typedef struct MVMOSHandle MVMOSHandle;
 typedef struct MVMOSHandleBody MVMOSHandleBody;
 typedef struct MVMP6bigint MVMP6bigint;
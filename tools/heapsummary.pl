@@ -0,0 +1,155 @@
+use warnings; use strict;
+# Summarizes a heap snapshot, such as one written by the heapsnapshot op.
+# For each type, we print how many of its objects are alive and the bytes
+# they take themselves. We then work out what each thing retains: the bytes
+# that would be freed along with it, being those of the things that can only
+# be reached from the roots through it. The things retaining the most are
+# printed, and for each kind of root, how much it retains. Sizes are those
+# the VM knows of; memory that a representation manages on its own (such as
+# the storage of an array or hash) is not counted.
+#
+# Usage: perl tools/heapsummary.pl [--top=N] snapshot
+
+use Getopt::Long;
+
+my $top = 20;
+GetOptions('top=i' => \$top)
+    or die "Usage: $0 [--top=N] snapshot\n";
+my $file = shift or die "Usage: $0 [--top=N] snapshot\n";
+
+my @kinds      = ('object', 'type object', 'STable', 'frame');
+my @root_kinds = ('permanent', 'instance', 'sc', 'thread', 'temporary', 'frame');
+
+# Read the snapshot.
+open my $fh, '<:raw', $file or die "Cannot open $file: $!";
+local $/;
+my $data = <$fh>;
+close $fh;
+substr($data, 0, 8) eq 'MVMHEAP1' or die "$file is not a heap snapshot\n";
+my (@names, @name_of, @size_of, @kind_of, @refs_of, @roots);
+my $pos = 8;
+while (1) {
+    die "$file is truncated\n" if $pos >= length $data;
+    my $type = substr($data, $pos++, 1);
+    if ($type eq 'n') {
+        my ($id, $len) = unpack 'LL', substr($data, $pos, 8);
+        $names[$id] = substr($data, $pos + 8, $len);
+        $pos += 8 + $len;
+    }
+    elsif ($type eq 'o') {
+        my ($id, $name, $size, $kind, $num_refs) = unpack 'LLLCL', substr($data, $pos, 17);
+        $pos += 17;
+        $name_of[$id] = $name;
+        $size_of[$id] = $size;
+        $kind_of[$id] = $kind;
+        $refs_of[$id] = [ unpack "L$num_refs", substr($data, $pos, 4 * $num_refs) ];
+        $pos += 4 * $num_refs;
+    }
+    elsif ($type eq 'r') {
+        my ($kind, $thread, $id) = unpack 'CLL', substr($data, $pos, 9);
+        $pos += 9;
+        push @roots, [ $kind, $thread, $id ];
+    }
+    elsif ($type eq 'e') {
+        last;
+    }
+    else {
+        die "Unknown record type '$type' at offset " . ($pos - 1) . "\n";
+    }
+}
+my $num = @size_of;
+sub name { my $n = $names[$name_of[$_[0]]]; $n =~ s/ /: /; "$n ($kinds[$kind_of[$_[0]]])" }
+
+# Count objects and bytes by type.
+my (%count, %shallow);
+my $total = 0;
+for my $id (0 .. $num - 1) {
+    my $name = name($id);
+    $count{$name}++;
+    $shallow{$name} += $size_of[$id];
+    $total += $size_of[$id];
+}
+printf "%d things alive, taking %d bytes, reached from %d roots\n\n", $num, $total, scalar @roots;
+printf "%12s %12s  %s\n", 'count', 'bytes', 'type';
+for my $name (sort { $shallow{$b} <=> $shallow{$a} || $a cmp $b } keys %shallow) {
+    printf "%12d %12d  %s\n", $count{$name}, $shallow{$name}, $name;
+}
+
+# Find the immediate dominator of each thing, with the iterative algorithm
+# of Cooper, Harvey and Kennedy, over a graph with an extra node (numbered
+# $num) whose references are the roots.
+my @succ = @refs_of;
+$succ[$num] = [ map { $_->[2] } @roots ];
+my (@preds, @order, @rpo_index);
+for my $id (0 .. $num) {
+    push @{ $preds[$_] }, $id for @{ $succ[$id] };
+}
+{
+    my @visited;
+    my @stack = ([ $num, 0 ]);
+    $visited[$num] = 1;
+    while (@stack) {
+        my $top = $stack[-1];
+        my $next = $succ[$top->[0]][$top->[1]++];
+        if (!defined $next) {
+            push @order, $top->[0];
+            pop @stack;
+        }
+        elsif (!$visited[$next]) {
+            $visited[$next] = 1;
+            push @stack, [ $next, 0 ];
+        }
+    }
+    @order = reverse @order;
+    $rpo_index[$order[$_]] = $_ for 0 .. $#order;
+}
+my @idom;
+$idom[$num] = $num;
+my $changed = 1;
+while ($changed) {
+    $changed = 0;
+    for my $id (@order[1 .. $#order]) {
+        my $new;
+        for my $pred (@{ $preds[$id] }) {
+            next unless defined $idom[$pred];
+            if (!defined $new) {
+                $new = $pred;
+                next;
+            }
+            my ($a, $b) = ($pred, $new);
+            while ($a != $b) {
+                $a = $idom[$a] while $rpo_index[$a] > $rpo_index[$b];
+                $b = $idom[$b] while $rpo_index[$b] > $rpo_index[$a];
+            }
+            $new = $a;
+        }
+        if (!defined $idom[$id] || $idom[$id] != $new) {
+            $idom[$id] = $new;
+            $changed = 1;
+        }
+    }
+}
+
+# Each thing retains its own size and what the things it dominates retain.
+my @retained = (@size_of, 0);
+for my $id (reverse @order[1 .. $#order]) {
+    $retained[$idom[$id]] += $retained[$id];
+}
+my @biggest = (sort { $retained[$b] <=> $retained[$a] } 0 .. $num - 1)[0 .. ($top < $num ? $top : $num) - 1];
+printf "\n%12s %12s  %s\n", 'retained', 'bytes', 'thing';
+printf "%12d %12d  %s #%d\n", $retained[$_], $size_of[$_], name($_), $_ for @biggest;
+
+# Attribute what is retained by the roots to the kind of root each is; a
+# thing that is a root in more than one way goes to the first.
+my (%root_count, %root_retained, %seen);
+for my $root (@roots) {
+    my ($kind, $thread, $id) = @$root;
+    my $what = $root_kinds[$kind] . ($kind >= 3 ? " (thread $thread)" : '');
+    $root_count{$what}++;
+    next if $seen{$id}++ || $idom[$id] != $num;
+    $root_retained{$what} += $retained[$id];
+}
+printf "\n%12s %12s  %s\n", 'roots', 'retained', 'root kind';
+for my $what (sort { ($root_retained{$b} // 0) <=> ($root_retained{$a} // 0) || $a cmp $b } keys %root_count) {
+    printf "%12d %12d  %s\n", $root_count{$what}, $root_retained{$what} // 0, $what;
+}
@@ -0,0 +1,91 @@
+use warnings; use strict;
+# Suggests superinstructions from a profile of how often each pair of ops
+# runs one after the other, such as the one written by moarvm --profile-ops.
+# The profile's op pair lines, of the form
+#
+#     <count> [<percent>%] <previous op> <op>
+#
+# are read from the given file, or from standard input. Sequences are grown
+# from the most frequent pairs, and we print those that execute at least the
+# given share of all pairs, together with an estimate of how often each one
+# runs. Sequences that are already superinstructions are marked as such.
+#
+# Usage: perl tools/superops.pl [--min-percent=N] [--max-ops=N] [profile]
+
+use Getopt::Long;
+
+my $oplist      = 'src/core/oplist';
+my $min_percent = 0.5;
+my $max_ops     = 4;
+GetOptions('min-percent=f' => \$min_percent, 'max-ops=i' => \$max_ops)
+    or die "Usage: $0 [--min-percent=N] [--max-ops=N] [profile]\n";
+
+# A static analysis over the oplist decides where an op may go in a fused
+# sequence. Ops that take a branch target, or that may leave the frame,
+# can only come last. Ops that may invoke code (decont, for example) can
+# still be fused, but the handler must check for it, as getlex_decont_findmeth
+# does. Superinstructions themselves are never fused again.
+my %ends_sequence = map { $_ => 1 } qw(
+    goto jumplist return return_i return_n return_s return_o
+    invoke_v invoke_i invoke_n invoke_s invoke_o
+    throwdyn throwlex throwlexotic throwcatdyn throwcatlex throwcatlexotic
+    die invokewithcapture
+);
+my (%known, %existing, $bank_name);
+open my $ol, '<', $oplist or die "Cannot open $oplist: $!";
+while (<$ol>) {
+    chomp;
+    if (/^BANK\s+(\d+)\s+(\S+)/) {
+        $bank_name = $2;
+        next;
+    }
+    next if /^#/ || /^\s*$/;
+    my ($code, $name, @operands) = split /\s+/;
+    if ($bank_name eq 'superinstructions') {
+        $existing{$name} = 1;
+        next;
+    }
+    $known{$name} = 1;
+    $ends_sequence{$name} = 1 if grep { $_ eq 'ins' } @operands;
+}
+close $ol;
+
+# Read the op pair counts.
+my (%pairs, $total);
+while (<>) {
+    next unless /^\s*(\d+)\s+(?:[\d.]+%\s+)?(\w+)\s+(\w+)\s*$/;
+    my ($count, $prev, $op) = ($1, $2, $3);
+    next unless $known{$prev} && $known{$op};
+    $pairs{$prev}{$op} += $count;
+    $total += $count;
+}
+die "No op pairs found in the profile\n" unless $total;
+my $min_count = $total * $min_percent / 100;
+
+# Grow sequences from the pairs. A two-op sequence counts as often as its
+# pair ran. Each op added after that scales the count by the share of the
+# pairs starting at the previous last op that go on to the new op, as if
+# each op only depended on the one before it.
+my %candidates;
+sub grow {
+    my ($count, @seq) = @_;
+    $candidates{join ' ', @seq} = $count if @seq > 1;
+    return if @seq >= $max_ops || $ends_sequence{$seq[-1]};
+    my $last = $seq[-1];
+    my $follows = 0;
+    $follows += $_ for values %{$pairs{$last} || {}};
+    for my $next (keys %{$pairs{$last} || {}}) {
+        my $pair  = $pairs{$last}{$next};
+        my $grown = @seq > 1 ? $count * $pair / $follows : $pair;
+        grow($grown, @seq, $next) if $grown >= $min_count;
+    }
+}
+grow(0, $_) for grep { !$ends_sequence{$_} } keys %pairs;
+
+# Report the candidates, most frequent first.
+printf "%d op pairs executed; showing sequences above %s%%\n\n", $total, $min_percent;
+for my $seq (sort { $candidates{$b} <=> $candidates{$a} || $a cmp $b } keys %candidates) {
+    my $name = join '_', split / /, $seq;
+    printf "%12.0f  %6.2f%%  %s%s\n", $candidates{$seq}, 100 * $candidates{$seq} / $total,
+        $seq, $existing{$name} ? "  (superinstruction $name)" : '';
+}